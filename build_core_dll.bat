@@ -8,8 +8,16 @@ set UM_INCLUDE=C:\Program Files (x86)\Windows Kits\10\Include\10.0.26100.0\um
 set UCRT_LIB=C:\Program Files (x86)\Windows Kits\10\Lib\10.0.26100.0\ucrt\x64
 set UM_LIB=C:\Program Files (x86)\Windows Kits\10\Lib\10.0.26100.0\um\x64
 
+REM Optional gzip support: set ZLIB_ROOT to a zlib install (include\zlib.h, lib\zlib.lib)
+set ZLIB_FLAGS=
+set ZLIB_LIBS=
+if defined ZLIB_ROOT (
+    set ZLIB_FLAGS=/DCOVERAGE_PARSER_HAVE_ZLIB=1 /I"%ZLIB_ROOT%\include"
+    set ZLIB_LIBS=/LIBPATH:"%ZLIB_ROOT%\lib" zlib.lib
+)
+
 echo Building core parsers DLL...
-cl /LD src\assert_parser.cpp src\dashboard_parser.cpp src\groups_parser.cpp src\hierarchy_parser.cpp src\modlist_parser.cpp src\parser_utils.cpp /std:c++17 /EHsc /DBUILDING_COVERAGE_PARSER_DLL /I include /I"%UCRT_INCLUDE%" /I"%SHARED_INCLUDE%" /I"%UM_INCLUDE%" /Fe:bin\FunctionalCoverageParsers.dll /DEF:FunctionalCoverageParsers.def /link /LIBPATH:"%UCRT_LIB%" /LIBPATH:"%UM_LIB%"
+cl /LD src\assert_parser.cpp src\dashboard_parser.cpp src\groups_parser.cpp src\hierarchy_parser.cpp src\modlist_parser.cpp src\parser_utils.cpp src\line_classifier.cpp src\thread_pool.cpp src\memory_pool.cpp src\string_interner.cpp src\hierarchy_tree.cpp src\coverage_snapshot.cpp src\parse_cache.cpp src\compressed_input.cpp src\record_stream.cpp /std:c++17 /EHsc /DBUILDING_COVERAGE_PARSER_DLL %ZLIB_FLAGS% /I include /I"%UCRT_INCLUDE%" /I"%SHARED_INCLUDE%" /I"%UM_INCLUDE%" /Fe:bin\FunctionalCoverageParsers.dll /DEF:FunctionalCoverageParsers.def /link /LIBPATH:"%UCRT_LIB%" /LIBPATH:"%UM_LIB%" %ZLIB_LIBS%
 
 if %ERRORLEVEL% EQU 0 (
     echo ✅ Core DLL built successfully!
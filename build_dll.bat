@@ -45,8 +45,25 @@ src\hierarchy_parser.cpp ^
 src\modlist_parser.cpp ^
 src\assert_parser.cpp ^
 src\parser_utils.cpp ^
+src\line_classifier.cpp ^
+src\thread_pool.cpp ^
+src\memory_pool.cpp ^
+src\string_interner.cpp ^
+src\hierarchy_tree.cpp ^
+src\coverage_snapshot.cpp ^
+src\parse_cache.cpp ^
+src\compressed_input.cpp ^
+src\record_stream.cpp ^
 src\dll_api.cpp
 
+REM Optional gzip support: set ZLIB_ROOT to a zlib install (include\zlib.h, lib\zlib.lib)
+set ZLIB_FLAGS=
+set ZLIB_LIBS=
+if defined ZLIB_ROOT (
+    set ZLIB_FLAGS=/DCOVERAGE_PARSER_HAVE_ZLIB=1 /I"%ZLIB_ROOT%\include"
+    set ZLIB_LIBS=/LIBPATH:"%ZLIB_ROOT%\lib" zlib.lib
+)
+
 REM Define compiler flags
 set CL_FLAGS=^
 /std:c++17 ^
@@ -71,7 +88,7 @@ set LINK_FLAGS=^
 
 echo.
 echo Compiling source files...
-cl %CL_FLAGS% %SRC_FILES% /link %LINK_FLAGS%
+cl %CL_FLAGS% %ZLIB_FLAGS% %SRC_FILES% /link %LINK_FLAGS% %ZLIB_LIBS%
 
 if %ERRORLEVEL% neq 0 (
     echo.
@@ -0,0 +1,112 @@
+/**
+ * @file compressed_input.h
+ * @brief Transparent reading of gzip and zstd compressed reports
+ *
+ * Archived reports are usually stored compressed (groups.txt.gz,
+ * asserts.txt.zst). Both parser families read them directly, with no
+ * temporary file: the format is recognised by its magic bytes, never by the
+ * file name.
+ *
+ * - The standard parsers read a ReportStream, which decompresses in fixed
+ *   size blocks as lines are consumed.
+ * - The high-performance parsers map their input through MemoryMappedFile,
+ *   which decompresses a compressed report into memory with
+ *   decompress_buffer(). Every frame of a multi-frame zstd file (as written
+ *   by `zstd -T0` or `pzstd`) is decompressed on the shared thread pool
+ *   straight into its place in the output.
+ *
+ * Support for each format is compiled in when the build defines
+ * COVERAGE_PARSER_HAVE_ZLIB or COVERAGE_PARSER_HAVE_ZSTD (CMake does so
+ * when it finds the library). A compressed file whose format is not
+ * compiled in cannot be opened.
+ *
+ * USAGE EXAMPLE:
+ * ```cpp
+ * ReportStream report("groups.txt.gz");
+ * std::string line;
+ * while (report.is_open() && std::getline(report, line)) {
+ *     process(line);
+ * }
+ * ```
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#ifndef COMPRESSED_INPUT_H
+#define COMPRESSED_INPUT_H
+
+#include "functional_coverage_parser.h"
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <streambuf>
+#include <string>
+
+namespace coverage_parser {
+
+/**
+ * @brief Container format of a report file
+ */
+enum class Compression {
+    NONE,   /**< Plain text */
+    GZIP,   /**< RFC 1952, one or more members */
+    ZSTD    /**< Zstandard, one or more frames */
+};
+
+/**
+ * @brief Recognise the format from the first bytes of a file
+ */
+COVERAGE_PARSER_API Compression detect_compression(const void* data, std::size_t size);
+
+/**
+ * @brief Whether this build can decompress @p compression
+ */
+COVERAGE_PARSER_API bool compression_supported(Compression compression);
+
+/**
+ * @brief Decompress a whole in-memory file
+ * @param output Receives the decompressed bytes, followed by one NUL
+ * @param output_size Decompressed size, excluding the NUL
+ * @return false if the data is corrupt or the format is not supported
+ */
+COVERAGE_PARSER_API bool decompress_buffer(const char* data, std::size_t size, Compression compression,
+                                           std::unique_ptr<char[]>& output, std::size_t& output_size);
+
+/**
+ * @brief Size of a report's text, for sizing tables before parsing
+ *
+ * The file size for plain files. For compressed files, the decompressed
+ * size their headers record: the sum of the frame content sizes for zstd,
+ * the last member's size (modulo 2^32) for gzip. The file size again when
+ * the headers do not tell, and 0 if the file cannot be read.
+ */
+COVERAGE_PARSER_API std::size_t report_content_size(const std::string& filename);
+
+/**
+ * @brief Input stream over a report file, plain or compressed
+ *
+ * Reads plain files as std::ifstream does. Compressed files are decoded
+ * block by block, so memory use does not grow with the report. Seeking
+ * supports only rewinding to the start, which is what the parsers do.
+ */
+class COVERAGE_PARSER_API ReportStream : public std::istream {
+public:
+    explicit ReportStream(const std::string& filename);
+    ~ReportStream() override;
+
+    ReportStream(const ReportStream&) = delete;
+    ReportStream& operator=(const ReportStream&) = delete;
+
+    bool is_open() const { return buffer_ != nullptr; }
+    Compression compression() const { return compression_; }
+
+private:
+    std::unique_ptr<std::streambuf> buffer_;
+    Compression                     compression_ = Compression::NONE;
+};
+
+} // namespace coverage_parser
+
+#endif /* COMPRESSED_INPUT_H */
@@ -0,0 +1,333 @@
+/**
+ * @file coverage_snapshot.h
+ * @brief Binary snapshot of a CoverageDatabase that opens by memory mapping
+ *
+ * Coverage reports never change once a simulation has finished, yet every
+ * run used to re-parse them as text. write_snapshot() stores a parsed
+ * database in a binary file whose layout is used in place: SnapshotReader
+ * maps the file, checks the header, and answers record and name lookups
+ * directly from the mapping, with no per-record parsing or allocation.
+ * Opening costs the same for a thousand records as for ten million.
+ *
+ * FILE LAYOUT (all integers in the writer's byte order, sections 8-aligned):
+ *   Header                 magic, version, byte-order mark, file size,
+ *                          flags, section table, header checksum
+ *   DASHBOARD              0 or 1 DashboardRecord
+ *   GROUPS / INSTANCES /   fixed-size records; every string field is a Text
+ *   MODULES / ASSERTS      (offset, length) into STRINGS; INSTANCES are in
+ *                          hierarchy tree order, so a load rebuilds the tree
+ *                          with the same child order
+ *   *_INDEX                open-addressing hash table of IndexSlots per kind,
+ *                          keyed by the record's name (FNV-1a, linear probing)
+ *   STRINGS                NUL-terminated text, each distinct string once
+ *
+ * Each section carries its own checksum. open() validates the header and
+ * the section bounds, which is O(1); verify_checksums() (or
+ * open(..., true)) additionally reads every byte, which is what you want
+ * after copying a snapshot between machines, not on every open.
+ *
+ * USAGE EXAMPLE:
+ * ```cpp
+ * write_snapshot(db, "run42.fcsnap");
+ *
+ * SnapshotReader snapshot;
+ * if (snapshot.open("run42.fcsnap") == ParserResult::SUCCESS) {
+ *     if (const snapshot::GroupRecord* group = snapshot.find_group("tb.cpu::cg")) {
+ *         std::cout << snapshot.text(group->name) << ": " << group->coverage.score << std::endl;
+ *     }
+ *     for (const snapshot::AssertRecord& assert_rec : snapshot.asserts()) { ... }
+ * }
+ *
+ * CoverageDatabase copy;
+ * load_snapshot("run42.fcsnap", copy);   // Full CoverageDatabase, when one is needed
+ * ```
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#ifndef COVERAGE_SNAPSHOT_H
+#define COVERAGE_SNAPSHOT_H
+
+#include "functional_coverage_parser.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace coverage_parser {
+
+namespace performance {
+class MemoryMappedFile;
+}
+
+/**
+ * @brief On-disk structures of the snapshot format
+ *
+ * Every structure is trivially copyable with explicit padding, so the same
+ * bytes are written and later read in place.
+ */
+namespace snapshot {
+
+constexpr char          MAGIC[8] = {'F', 'C', 'P', 'S', 'N', 'A', 'P', '\0'};
+constexpr std::uint32_t FORMAT_VERSION = 1;
+constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+constexpr std::uint32_t EMPTY_SLOT = 0xFFFFFFFFu;
+
+enum class SectionKind : std::uint32_t {
+    DASHBOARD = 0,
+    GROUPS,
+    GROUP_INDEX,
+    INSTANCES,
+    INSTANCE_INDEX,
+    MODULES,
+    MODULE_INDEX,
+    ASSERTS,
+    ASSERT_INDEX,
+    STRINGS,
+    COUNT
+};
+
+constexpr std::uint32_t SECTION_COUNT = static_cast<std::uint32_t>(SectionKind::COUNT);
+
+// Header flags
+constexpr std::uint32_t FLAG_DATABASE_VALID = 1u << 0;  /**< CoverageDatabase::is_valid */
+
+/**
+ * @brief String stored in the STRINGS section (NUL-terminated there)
+ */
+struct Text {
+    std::uint64_t offset;
+    std::uint32_t length;
+    std::uint32_t reserved;
+};
+
+struct Metrics {
+    double        score;
+    std::uint32_t covered;
+    std::uint32_t expected;
+    std::uint32_t is_valid;
+    std::uint32_t reserved;
+};
+
+struct DashboardRecord {
+    Text          date;
+    Text          user;
+    Text          version;
+    Text          command_line;
+    double        total_score;
+    Metrics       assert_coverage;
+    Metrics       group_coverage;
+    std::int64_t  generation_time_ns;   /**< Since the system_clock epoch */
+    std::uint32_t num_hierarchical_instances;
+    std::uint32_t reserved;
+};
+
+struct GroupRecord {
+    Text          name;
+    Text          comment;
+    Metrics       coverage;
+    Metrics       instance_coverage;
+    std::uint32_t instances;
+    std::uint32_t weight;
+    std::uint32_t goal;
+    std::uint32_t at_least;
+    std::uint32_t per_instance;
+    std::uint32_t auto_bin_max;
+    std::uint32_t print_missing;
+    std::uint32_t is_auto_generated;
+};
+
+struct InstanceRecord {
+    Text          instance_path;
+    Text          module_name;
+    double        total_score;
+    Metrics       assert_coverage;
+    Metrics       group_coverage;
+    std::uint32_t depth_level;
+    std::uint32_t is_leaf_instance;
+};
+
+struct ModuleRecord {
+    Text          module_name;
+    double        total_score;
+    Metrics       assert_coverage;
+    Metrics       group_coverage;
+    std::uint32_t instance_count;
+    std::uint32_t covered_instances;
+};
+
+struct AssertRecord {
+    Text          assert_name;
+    Text          instance_path;
+    Text          file_location;
+    Text          severity;
+    Text          message;
+    std::uint32_t line_number;
+    std::uint32_t is_covered;
+    std::uint32_t hit_count;
+    std::uint32_t reserved;
+};
+
+/**
+ * @brief Hash index slot: record number, or EMPTY_SLOT
+ *
+ * hash_tag holds the low 32 bits of the name hash, so most probes that
+ * land on another name are rejected without touching STRINGS.
+ */
+struct IndexSlot {
+    std::uint32_t record;
+    std::uint32_t hash_tag;
+};
+
+struct Section {
+    std::uint32_t kind;
+    std::uint32_t reserved;
+    std::uint64_t offset;     /**< From the start of the file */
+    std::uint64_t size;       /**< Bytes */
+    std::uint64_t count;      /**< Records, index slots or string bytes */
+    std::uint64_t checksum;   /**< checksum() of the section's bytes */
+};
+
+struct Header {
+    char          magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint64_t file_size;
+    std::uint32_t flags;
+    std::uint32_t section_count;
+    Section       sections[SECTION_COUNT];
+    std::uint64_t header_checksum;   /**< checksum() of the header with this field zeroed */
+};
+
+static_assert(std::is_trivially_copyable<Header>::value && sizeof(Text) == 16 && sizeof(Metrics) == 24 &&
+              sizeof(Section) == 40 && sizeof(IndexSlot) == 8, "snapshot structures must have a fixed layout");
+
+/**
+ * @brief Hash of record names in the *_INDEX sections (64-bit FNV-1a)
+ */
+std::uint64_t name_hash(std::string_view name);
+
+/**
+ * @brief 64-bit checksum of the section bytes (4-lane multiply-rotate)
+ */
+std::uint64_t checksum(const void* data, std::size_t size);
+
+/**
+ * @brief Contiguous records of one section, usable in range-based for loops
+ */
+template <typename T>
+class RecordSpan {
+public:
+    RecordSpan() = default;
+    RecordSpan(const T* first, std::size_t count) : first_(first), count_(count) {}
+    const T* begin() const { return first_; }
+    const T* end() const { return first_ + count_; }
+    std::size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+    const T& operator[](std::size_t index) const { return first_[index]; }
+
+private:
+    const T* first_ = nullptr;
+    std::size_t count_ = 0;
+};
+
+} // namespace snapshot
+
+/**
+ * @brief Read-only view of a snapshot file, served from a memory mapping
+ *
+ * Records and strings returned by the reader point into the mapping and
+ * stay valid until close() or destruction. Lookups are thread-safe.
+ */
+class COVERAGE_PARSER_API SnapshotReader {
+public:
+    SnapshotReader();
+    ~SnapshotReader();
+    SnapshotReader(SnapshotReader&&) noexcept;
+    SnapshotReader& operator=(SnapshotReader&&) noexcept;
+
+    /**
+     * @brief Map @p filename and validate its header and section table
+     * @param verify Also check every section's checksum (reads the whole file)
+     * @return ERROR_FILE_NOT_FOUND if it cannot be mapped, ERROR_INVALID_FORMAT
+     *         for a foreign, corrupt or incompatible file
+     */
+    ParserResult open(const std::string& filename, bool verify = false);
+    void close();
+    bool is_open() const { return header_ != nullptr; }
+
+    /**
+     * @brief Check every section's checksum
+     */
+    ParserResult verify_checksums() const;
+
+    bool database_valid() const { return header_ && (header_->flags & snapshot::FLAG_DATABASE_VALID) != 0; }
+    const snapshot::DashboardRecord* dashboard() const;   /**< nullptr if the database had none */
+
+    snapshot::RecordSpan<snapshot::GroupRecord> groups() const { return groups_; }
+    snapshot::RecordSpan<snapshot::InstanceRecord> instances() const { return instances_; }
+    snapshot::RecordSpan<snapshot::ModuleRecord> modules() const { return modules_; }
+    snapshot::RecordSpan<snapshot::AssertRecord> asserts() const { return asserts_; }
+
+    // Name lookups through the stored hash indexes; nullptr if absent
+    const snapshot::GroupRecord* find_group(std::string_view name) const;
+    const snapshot::InstanceRecord* find_instance(std::string_view path) const;
+    const snapshot::ModuleRecord* find_module(std::string_view name) const;
+    const snapshot::AssertRecord* find_assert(std::string_view name) const;
+
+    /**
+     * @brief Characters of a stored string (NUL-terminated); empty if out of bounds
+     */
+    std::string_view text(const snapshot::Text& text) const;
+
+private:
+    std::unique_ptr<performance::MemoryMappedFile>  file_;
+    const snapshot::Header*                         header_ = nullptr;
+    const snapshot::DashboardRecord*                dashboard_ = nullptr;
+    snapshot::RecordSpan<snapshot::GroupRecord>     groups_;
+    snapshot::RecordSpan<snapshot::InstanceRecord>  instances_;
+    snapshot::RecordSpan<snapshot::ModuleRecord>    modules_;
+    snapshot::RecordSpan<snapshot::AssertRecord>    asserts_;
+    snapshot::RecordSpan<snapshot::IndexSlot>       group_index_;
+    snapshot::RecordSpan<snapshot::IndexSlot>       instance_index_;
+    snapshot::RecordSpan<snapshot::IndexSlot>       module_index_;
+    snapshot::RecordSpan<snapshot::IndexSlot>       assert_index_;
+    std::string_view                                strings_;
+
+    template <typename T>
+    const T* find_record(snapshot::RecordSpan<T> records, snapshot::RecordSpan<snapshot::IndexSlot> index,
+                         std::string_view name) const;
+};
+
+/**
+ * @brief Write @p db to @p filename as a snapshot
+ * @return ERROR_FILE_NOT_FOUND if the file cannot be written,
+ *         ERROR_INVALID_PARAMETER if a table exceeds the format's 2^32 records
+ */
+COVERAGE_PARSER_API ParserResult write_snapshot(const CoverageDatabase& db, const std::string& filename);
+
+/**
+ * @brief Replace the contents of @p db with the snapshot in @p filename
+ *
+ * Verifies every checksum first, then creates one record per stored record.
+ * For lookups alone, SnapshotReader avoids that work.
+ */
+COVERAGE_PARSER_API ParserResult load_snapshot(const std::string& filename, CoverageDatabase& db);
+
+/**
+ * @brief Add the records of the snapshot in @p filename to @p db
+ *
+ * Like parsing another report into @p db: stored records replace
+ * same-named ones, and a stored dashboard replaces the current one. All
+ * records are created before any is added, so @p db gains either every
+ * record or, if the snapshot does not verify or memory runs out, none.
+ */
+COVERAGE_PARSER_API ParserResult merge_snapshot(const std::string& filename, CoverageDatabase& db);
+
+} // namespace coverage_parser
+
+#endif /* COVERAGE_SNAPSHOT_H */
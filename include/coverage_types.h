@@ -5,7 +5,7 @@
  * This header defines all data structures used by the FunctionalCoverageParsers library
  * to represent different types of coverage reports from EDA tools (DVE/VCS/URG).
  * 
- * The library uses modern C++ containers (std::unordered_map, std::vector, std::string)
+ * The library uses modern C++ containers (flat hash maps, std::vector, std::string)
  * for efficient storage and retrieval of coverage data.
  * 
  * @author FunctionalCoverageParsers Library
@@ -33,17 +33,24 @@
 #define COVERAGE_TYPES_H
 
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <cstring>
+#include <atomic>
+#include <functional>
+#include <mutex>
 #include <vector>
 #include <memory>
 #include <chrono>
-
-// Define integer types for Windows compatibility
-typedef unsigned int uint32_t;
-typedef unsigned long long uint64_t;
+#include <cstdint>
 #include <optional>
 #include <iostream>
 #include <fstream>
+#include "flat_hash_map.h"
+#include "hierarchy_tree.h"
+#include "name_index.h"
+#include "sharded_ingest.h"
+#include "trigram_index.h"
+#include "string_interner.h"
 
 namespace coverage_parser {
 
@@ -57,6 +64,189 @@ enum class ParserResult {
     ERROR_PARSE_FAILED
 };
 
+namespace performance {
+class MemoryPool;
+}
+
+/**
+ * @brief Compact string used for the text fields of coverage records
+ * 
+ * Either owns a heap buffer (like std::string) or refers to characters that
+ * live elsewhere, typically in a CoverageDatabase arena. The text is always
+ * NUL-terminated. Copies are always owning, so a copied record never refers
+ * to another database's arena.
+ * 
+ * Converts implicitly to std::string_view and std::string and compares with
+ * both, so most code reading record fields is unaffected by the type.
+ */
+class RecordString {
+public:
+    RecordString() noexcept = default;
+    explicit RecordString(std::string_view text) { assign(text); }
+    
+    RecordString(const RecordString& other) { assign(other.view()); }
+    RecordString(RecordString&& other) noexcept
+        : data_(other.data_), size_(other.size_), owned_(other.owned_) {
+        other.release_to_empty();
+    }
+    
+    ~RecordString() { free_owned(); }
+    
+    RecordString& operator=(const RecordString& other) {
+        if (this != &other) {
+            assign(other.view());
+        }
+        return *this;
+    }
+    
+    RecordString& operator=(RecordString&& other) noexcept {
+        if (this != &other) {
+            free_owned();
+            data_ = other.data_;
+            size_ = other.size_;
+            owned_ = other.owned_;
+            other.release_to_empty();
+        }
+        return *this;
+    }
+    
+    RecordString& operator=(std::string_view text) { return assign(text); }
+    
+    /**
+     * @brief Refer to @p size characters at @p data without copying
+     * 
+     * @p data must be NUL-terminated at @p size and outlive the string.
+     */
+    static RecordString external(const char* data, std::size_t size) noexcept {
+        RecordString result;
+        result.data_ = data;
+        result.size_ = static_cast<std::uint32_t>(size);
+        return result;
+    }
+    
+    RecordString& assign(std::string_view text) {
+        if (text.empty()) {
+            clear();
+            return *this;
+        }
+        char* buffer = new char[text.size() + 1];
+        std::memcpy(buffer, text.data(), text.size());
+        buffer[text.size()] = '\0';
+        free_owned();
+        data_ = buffer;
+        size_ = static_cast<std::uint32_t>(text.size());
+        owned_ = true;
+        return *this;
+    }
+    RecordString& assign(const char* data, std::size_t size) { return assign(std::string_view(data, size)); }
+    
+    void clear() noexcept {
+        free_owned();
+        release_to_empty();
+    }
+    
+    // std::string-like read access
+    bool empty() const noexcept { return size_ == 0; }
+    std::size_t size() const noexcept { return size_; }
+    std::size_t length() const noexcept { return size_; }
+    const char* data() const noexcept { return data_; }
+    const char* c_str() const noexcept { return data_; }
+    const char* begin() const noexcept { return data_; }
+    const char* end() const noexcept { return data_ + size_; }
+    char operator[](std::size_t index) const noexcept { return data_[index]; }
+    
+    std::size_t find(std::string_view text, std::size_t pos = 0) const noexcept { return view().find(text, pos); }
+    std::size_t find(char c, std::size_t pos = 0) const noexcept { return view().find(c, pos); }
+    std::size_t rfind(std::string_view text, std::size_t pos = std::string_view::npos) const noexcept { return view().rfind(text, pos); }
+    std::size_t rfind(char c, std::size_t pos = std::string_view::npos) const noexcept { return view().rfind(c, pos); }
+    std::size_t find_last_of(char c, std::size_t pos = std::string_view::npos) const noexcept { return view().find_last_of(c, pos); }
+    std::string substr(std::size_t pos = 0, std::size_t count = std::string_view::npos) const {
+        return std::string(view().substr(pos, count));
+    }
+    
+    std::string_view view() const noexcept { return std::string_view(data_, size_); }
+    std::string str() const { return std::string(data_, size_); }
+    
+    operator std::string_view() const noexcept { return view(); }
+    operator std::string() const { return str(); }
+    
+private:
+    const char*   data_{""};     /**< Always NUL-terminated */
+    std::uint32_t size_{0};
+    bool          owned_{false}; /**< data_ was allocated with new[] */
+    
+    void free_owned() noexcept {
+        if (owned_) {
+            delete[] data_;
+        }
+    }
+    void release_to_empty() noexcept {
+        data_ = "";
+        size_ = 0;
+        owned_ = false;
+    }
+};
+
+inline bool operator==(const RecordString& lhs, const RecordString& rhs) noexcept { return lhs.view() == rhs.view(); }
+inline bool operator==(const RecordString& lhs, std::string_view rhs) noexcept { return lhs.view() == rhs; }
+inline bool operator==(std::string_view lhs, const RecordString& rhs) noexcept { return lhs == rhs.view(); }
+inline bool operator!=(const RecordString& lhs, const RecordString& rhs) noexcept { return !(lhs == rhs); }
+inline bool operator!=(const RecordString& lhs, std::string_view rhs) noexcept { return !(lhs == rhs); }
+inline bool operator!=(std::string_view lhs, const RecordString& rhs) noexcept { return !(lhs == rhs); }
+inline bool operator<(const RecordString& lhs, const RecordString& rhs) noexcept { return lhs.view() < rhs.view(); }
+
+inline std::string operator+(const RecordString& lhs, std::string_view rhs) {
+    std::string result(lhs.view());
+    result.append(rhs);
+    return result;
+}
+inline std::string operator+(std::string_view lhs, const RecordString& rhs) {
+    std::string result(lhs);
+    result.append(rhs.view());
+    return result;
+}
+inline std::string operator+(const RecordString& lhs, const RecordString& rhs) { return lhs + rhs.view(); }
+
+inline std::ostream& operator<<(std::ostream& os, const RecordString& text) { return os << text.view(); }
+
+/**
+ * @brief Deleter for records that may live in a CoverageDatabase arena
+ * 
+ * Arena records are only destroyed; their memory is released with the arena.
+ * Converts from std::default_delete so std::unique_ptr records can still be
+ * handed to a database.
+ */
+template <typename T>
+struct RecordDeleter {
+    bool arena{false};
+    
+    RecordDeleter() noexcept = default;
+    explicit RecordDeleter(bool in_arena) noexcept : arena(in_arena) {}
+    RecordDeleter(const std::default_delete<T>&) noexcept {}
+    
+    void operator()(T* record) const noexcept {
+        if (arena) {
+            record->~T();
+        } else {
+            delete record;
+        }
+    }
+};
+
+/**
+ * @brief Owning pointer to a database record (heap or arena)
+ */
+template <typename T>
+using RecordPtr = std::unique_ptr<T, RecordDeleter<T>>;
+
+/**
+ * @brief Where a CoverageDatabase allocates its records
+ */
+enum class StorageMode {
+    HEAP,   /**< One heap allocation per record and string */
+    ARENA   /**< Records and strings in contiguous chunks owned by the database */
+};
+
 /**
  * @brief Coverage metrics structure containing hit/total counts and percentages
  * 
@@ -276,8 +466,8 @@ public:
  */
 class CoverageGroup {
 public:
-    std::string                               name;                     /**< Full hierarchical group name */
-    std::string                               comment;                  /**< Optional comment/description */
+    RecordString                              name;                     /**< Full hierarchical group name */
+    RecordString                              comment;                  /**< Optional comment/description */
     
     CoverageMetrics                          coverage;                 /**< Basic coverage metrics */
     CoverageMetrics                          instance_coverage;        /**< Per-instance coverage */
@@ -294,7 +484,7 @@ public:
     
     // Constructors
     CoverageGroup() = default;
-    explicit CoverageGroup(const std::string& group_name) : name(group_name) {}
+    explicit CoverageGroup(std::string_view group_name) : name(group_name) {}
     
     // Utility methods
     bool meets_goal() const { return coverage.score >= goal; }
@@ -384,8 +574,8 @@ public:
  */
 class HierarchyInstance {
 public:
-    std::string                               instance_path;            /**< Full hierarchical path */
-    std::string                               module_name;              /**< Module/block name */
+    RecordString                              instance_path;            /**< Full hierarchical path */
+    RecordString                              module_name;              /**< Module/block name */
     
     double                                    total_score{0.0};         /**< Instance total score */
     CoverageMetrics                          assert_coverage;          /**< Assertion coverage */
@@ -396,7 +586,7 @@ public:
     
     // Constructors
     HierarchyInstance() = default;
-    explicit HierarchyInstance(const std::string& path) : instance_path(path) {
+    explicit HierarchyInstance(std::string_view path) : instance_path(path) {
         calculate_depth_level();
         extract_module_name();
     }
@@ -493,7 +683,7 @@ public:
  */
 class ModuleDefinition {
 public:
-    std::string                               module_name;              /**< Module definition name */
+    RecordString                              module_name;              /**< Module definition name */
     
     double                                    total_score{0.0};         /**< Module total score */
     CoverageMetrics                          assert_coverage;          /**< Assertion coverage */
@@ -504,7 +694,7 @@ public:
     
     // Constructors
     ModuleDefinition() = default;
-    explicit ModuleDefinition(const std::string& name) : module_name(name) {}
+    explicit ModuleDefinition(std::string_view name) : module_name(name) {}
     
     // Utility methods
     double instance_coverage_percentage() const {
@@ -607,24 +797,24 @@ public:
  */
 class AssertCoverage {
 public:
-    std::string                               assert_name;              /**< Assertion name/identifier */
-    std::string                               instance_path;            /**< Instance where assert exists */
-    std::string                               file_location;            /**< Source file location */
+    RecordString                              assert_name;              /**< Assertion name/identifier */
+    RecordString                              instance_path;            /**< Instance where assert exists */
+    RecordString                              file_location;            /**< Source file location */
     
     std::uint32_t                            line_number{0};           /**< Line number in source */
     bool                                     is_covered{false};        /**< Coverage status */
     std::uint32_t                            hit_count{0};             /**< Number of times hit */
     
-    std::string                               severity;                 /**< Assertion severity level */
-    std::string                               message;                  /**< Assertion message */
+    RecordString                              severity;                 /**< Assertion severity level */
+    RecordString                              message;                  /**< Assertion message */
     
     // Constructors
     AssertCoverage() = default;
-    explicit AssertCoverage(const std::string& name) : assert_name(name) {}
+    explicit AssertCoverage(std::string_view name) : assert_name(name) {}
     
     // Utility methods
     bool is_critical() const { return severity == "ERROR" || severity == "FATAL"; }
-    std::string get_full_location() const { return file_location + ":" + std::to_string(line_number); }
+    std::string get_full_location() const { return file_location + (":" + std::to_string(line_number)); }
 };
 
 /**
@@ -688,26 +878,102 @@ public:
     static ParserConfig create_detailed_parsing();
 };
 
+/**
+ * @brief Columnar (structure-of-arrays) view of a database's coverage groups
+ * 
+ * Row i of every column describes the same group, so i is a dense group ID
+ * and groups[i] is its record. Aggregates scan the metric columns as plain
+ * contiguous arrays (which the compiler vectorizes) instead of following one
+ * record pointer per group.
+ * 
+ * OUTPUT DATA STRUCTURE:
+ * {
+ *   covered: vector<uint32>         // coverage.covered per group
+ *   expected: vector<uint32>        // coverage.expected per group
+ *   score: vector<double>           // coverage.score per group
+ *   weight: vector<uint32>          // weight per group
+ *   goal: vector<uint32>            // goal per group
+ *   groups: vector<CoverageGroup*>  // Record of each row
+ * }
+ */
+class GroupColumns {
+public:
+    std::vector<std::uint32_t>                covered;                  /**< Covered items per group */
+    std::vector<std::uint32_t>                expected;                 /**< Expected items per group */
+    std::vector<double>                       score;                    /**< Coverage percentage per group */
+    std::vector<std::uint32_t>                weight;                   /**< Coverage weight per group */
+    std::vector<std::uint32_t>                goal;                     /**< Coverage goal per group */
+    std::vector<CoverageGroup*>               groups;                   /**< Record of each row */
+    
+    std::size_t size() const { return groups.size(); }
+    bool empty() const { return groups.empty(); }
+    
+    void reserve(std::size_t count);
+    void push_back(CoverageGroup& group);
+    void clear();
+};
+
 /**
  * @brief Master coverage database structure
  * 
  * Main container that holds all parsed coverage data from different report files.
  * Uses hash maps for efficient storage and retrieval of coverage information.
  * 
+ * In StorageMode::ARENA the records created through create_*() and their
+ * strings (make_string()) are carved out of chunks owned by the database, so
+ * reset() and destruction release them in O(chunks) instead of one free()
+ * per record and string. Records passed in from outside (std::unique_ptr)
+ * stay on the heap in either mode.
+ * 
+ * Names and paths are interned in either mode: the parsers store each
+ * distinct string once (intern()) and table keys are views of the interned
+ * copy, so a key never duplicates its record's name and repeated instance
+ * paths or file names are shared by all records that mention them.
+ * 
+ * The tables are open-addressing FlatHashMaps: a lookup probes 16 control
+ * bytes with one SIMD compare, and an insert never allocates a node.
+ * Inserting invalidates iterators into the same table.
+ * 
+ * Group aggregates (calculate_overall_score(), get_uncovered_groups(),
+ * generate_statistics()) scan GroupColumns, built from groups_table on first
+ * use and cached until the groups may have changed: add_coverage_group(),
+ * reset(), the non-const find_coverage_group() and group queries, and
+ * groups_begin() discard the cache. Code that writes to groups through
+ * groups_table directly must call invalidate_group_columns().
+ * 
+ * add_hierarchy_instance() also files each instance into a HierarchyTree,
+ * so subtree queries ("coverage under tb.cpu") never scan hierarchy_table.
+ * Subtree totals are recomputed on the first hierarchy_tree() call after the
+ * instances may have changed, with the same invalidation rules as groups
+ * (invalidate_hierarchy_rollups() for direct writes).
+ * 
+ * Prefix and scope queries over group names, instance paths and assertion
+ * names use NameIndexes: sorted copies of the table keys, built on first use
+ * and rebuilt after records are added. Substring and glob queries use
+ * TrigramIndexes, kept the same way; build_search_indexes() builds all of
+ * them up front, e.g. right after loading.
+ * 
+ * Parallel parsers insert through a sharded ingest instead of add_*():
+ * begin_ingest() opens hash-partitioned staging tables, ingest_*() may then
+ * be called from any thread with one batch of records at a time, and
+ * finish_ingest() moves everything into the tables once the batches are
+ * in. Within one key, a later batch (or a later record of the same batch)
+ * wins, as if the batches had been added serially in batch order.
+ * 
  * OUTPUT DATA STRUCTURE:
  * {
  *   dashboard_data: unique_ptr<DashboardData>           // Overall coverage summary
- *   groups_table: map<string, unique_ptr<CoverageGroup>> // Hash table of coverage groups
- *   hierarchy_table: map<string, unique_ptr<HierarchyInstance>> // Hash table of hierarchy instances
- *   modules_table: map<string, unique_ptr<ModuleDefinition>>    // Hash table of module definitions
- *   asserts_table: map<string, unique_ptr<AssertCoverage>>      // Hash table of assertions
+ *   groups_table: map<string_view, RecordPtr<CoverageGroup>> // Hash table of coverage groups
+ *   hierarchy_table: map<string_view, RecordPtr<HierarchyInstance>> // Hash table of hierarchy instances
+ *   modules_table: map<string_view, RecordPtr<ModuleDefinition>>    // Hash table of module definitions
+ *   asserts_table: map<string_view, RecordPtr<AssertCoverage>>      // Hash table of assertions
  *   last_updated: time_point                            // Last update timestamp
  *   is_valid: bool                                      // Database validity flag
  * }
  * 
  * USAGE EXAMPLES:
  * ```cpp
- * // Create and populate database
+ * // Create and populate database (StorageMode::ARENA for very large reports)
  * auto db = std::make_unique<CoverageDatabase>();
  * 
  * // Parse all coverage files
@@ -755,8 +1021,9 @@ public:
  *               << " (" << group->coverage.score << "%)" << std::endl;
  * }
  * 
- * // Search for groups by pattern (contains substring)
+ * // Search for groups by pattern (contains substring) or by glob
  * auto matching_groups = db->get_groups_by_pattern("cpu");
+ * auto fifo_groups = db->get_groups_by_glob("tb.*.fifo_?::cg*");
  * std::cout << "Groups matching 'cpu':" << std::endl;
  * for (const auto* group : matching_groups) {
  *     std::cout << "  " << group->name << ": " << group->coverage.score << "%" << std::endl;
@@ -798,28 +1065,115 @@ public:
     std::unique_ptr<DashboardData>                               dashboard_data;              /**< Overall coverage summary */
     
     // Hash tables for different coverage types
-    std::unordered_map<std::string, std::unique_ptr<CoverageGroup>>      groups_table;           /**< Hash table of coverage groups */
-    std::unordered_map<std::string, std::unique_ptr<HierarchyInstance>>  hierarchy_table;        /**< Hash table of hierarchy instances */
-    std::unordered_map<std::string, std::unique_ptr<ModuleDefinition>>   modules_table;          /**< Hash table of module definitions */
-    std::unordered_map<std::string, std::unique_ptr<AssertCoverage>>     asserts_table;          /**< Hash table of assertions */
+    FlatHashMap<std::string_view, RecordPtr<CoverageGroup>>      groups_table;           /**< Hash table of coverage groups */
+    FlatHashMap<std::string_view, RecordPtr<HierarchyInstance>>  hierarchy_table;        /**< Hash table of hierarchy instances */
+    FlatHashMap<std::string_view, RecordPtr<ModuleDefinition>>   modules_table;          /**< Hash table of module definitions */
+    FlatHashMap<std::string_view, RecordPtr<AssertCoverage>>     asserts_table;          /**< Hash table of assertions */
     
     // Metadata
     std::chrono::system_clock::time_point                        last_updated;               /**< Last update timestamp */
     bool                                                         is_valid{false};            /**< Database validity flag */
     
     // Constructor
-    CoverageDatabase();
+    explicit CoverageDatabase(StorageMode mode = StorageMode::HEAP);
     
-    // Destructor
-    ~CoverageDatabase() = default;
+    // Destructor (records are destroyed before the arena they live in)
+    ~CoverageDatabase();
     
     // Delete copy constructor and assignment operator
     CoverageDatabase(const CoverageDatabase&) = delete;
     CoverageDatabase& operator=(const CoverageDatabase&) = delete;
     
     // Move constructor and assignment operator
-    CoverageDatabase(CoverageDatabase&&) = default;
-    CoverageDatabase& operator=(CoverageDatabase&&) = default;
+    CoverageDatabase(CoverageDatabase&&);
+    CoverageDatabase& operator=(CoverageDatabase&&);
+    
+    // Storage
+    StorageMode storage_mode() const { return storage_mode_; }
+    std::size_t arena_bytes() const;  /**< Bytes reserved by the arena (0 in HEAP mode) */
+    
+    /**
+     * @brief Create an empty record in this database's storage
+     * 
+     * Safe to call from several threads at once (the parsers build records
+     * in parallel chunks). The record must be added to this database, or
+     * destroyed, before the database is reset.
+     */
+    RecordPtr<CoverageGroup> create_coverage_group();
+    RecordPtr<HierarchyInstance> create_hierarchy_instance();
+    RecordPtr<ModuleDefinition> create_module_definition();
+    RecordPtr<AssertCoverage> create_assert_coverage();
+    
+    /**
+     * @brief Pre-size storage for @p count records of one kind in total
+     * 
+     * Sizes the table and the interned-string store, and in ARENA mode the
+     * arena, so that adding up to @p count records neither rehashes nor
+     * grows storage piecemeal. Parsers call these with the total a report
+     * header declares. Counts at or below the current number of records are
+     * ignored. Must not overlap create_*() calls.
+     */
+    void reserve_coverage_groups(std::size_t count);
+    void reserve_hierarchy_instances(std::size_t count);
+    void reserve_module_definitions(std::size_t count);
+    void reserve_assert_coverage(std::size_t count);
+    
+    /**
+     * @brief Pre-size the hierarchy tree for @p count nodes in total
+     * 
+     * reserve_hierarchy_instances() reserves one node per instance; paths
+     * whose ancestors have no record of their own need more.
+     */
+    void reserve_hierarchy_nodes(std::size_t count);
+    
+    /**
+     * @brief Copy @p text into this database's storage
+     * 
+     * Returns an arena-backed string in ARENA mode, an owning one otherwise.
+     * Thread-safe like create_*().
+     */
+    RecordString make_string(std::string_view text);
+    
+    /**
+     * @brief Share the database's single copy of @p text
+     * 
+     * For names and paths that repeat across records. The string stays
+     * valid until reset(). Thread-safe like create_*().
+     */
+    RecordString intern(std::string_view text);
+    
+    const StringInterner& strings() const { return strings_; }  /**< Interned names, paths and table keys */
+    
+    /**
+     * @brief Open sharded staging tables for concurrent ingest_*() calls
+     * @param shards Shards per record kind, 0 to size from the core count
+     * 
+     * Discards any ingest that was never finished.
+     */
+    void begin_ingest(std::size_t shards = 0);
+    
+    /**
+     * @brief Stage one batch of records; thread-safe between begin_ingest() and finish_ingest()
+     * 
+     * Moves out of @p records[0, count). Records without a name are dropped,
+     * as by add_*(). Without an open ingest this is add_*() in a loop.
+     */
+    void ingest_coverage_groups(std::uint32_t batch, RecordPtr<CoverageGroup>* records, std::size_t count);
+    void ingest_hierarchy_instances(std::uint32_t batch, RecordPtr<HierarchyInstance>* records, std::size_t count);
+    void ingest_module_definitions(std::uint32_t batch, RecordPtr<ModuleDefinition>* records, std::size_t count);
+    void ingest_assert_coverage(std::uint32_t batch, RecordPtr<AssertCoverage>* records, std::size_t count);
+    
+    /**
+     * @brief Move the staged records into the tables; no ingest_*() call may be running
+     */
+    void finish_ingest();
+    
+    /**
+     * @brief Drop the staged records; no ingest_*() call may be running
+     */
+    void cancel_ingest();
+    
+    bool is_ingesting() const { return ingest_ != nullptr; }
     
     // Accessor methods
     std::uint32_t get_num_groups() const { return static_cast<std::uint32_t>(groups_table.size()); }
@@ -827,46 +1181,150 @@ public:
     std::uint32_t get_num_modules() const { return static_cast<std::uint32_t>(modules_table.size()); }
     std::uint32_t get_num_asserts() const { return static_cast<std::uint32_t>(asserts_table.size()); }
     
-    // Query methods
-    CoverageGroup* find_coverage_group(const std::string& name);
-    const CoverageGroup* find_coverage_group(const std::string& name) const;
+    // Query methods (keys are string_views: lookups never allocate)
+    CoverageGroup* find_coverage_group(std::string_view name);
+    const CoverageGroup* find_coverage_group(std::string_view name) const;
     
-    HierarchyInstance* find_hierarchy_instance(const std::string& path);
-    const HierarchyInstance* find_hierarchy_instance(const std::string& path) const;
+    HierarchyInstance* find_hierarchy_instance(std::string_view path);
+    const HierarchyInstance* find_hierarchy_instance(std::string_view path) const;
     
-    ModuleDefinition* find_module_definition(const std::string& name);
-    const ModuleDefinition* find_module_definition(const std::string& name) const;
+    ModuleDefinition* find_module_definition(std::string_view name);
+    const ModuleDefinition* find_module_definition(std::string_view name) const;
     
-    AssertCoverage* find_assert_coverage(const std::string& name);
-    const AssertCoverage* find_assert_coverage(const std::string& name) const;
+    AssertCoverage* find_assert_coverage(std::string_view name);
+    const AssertCoverage* find_assert_coverage(std::string_view name) const;
     
     // Data manipulation methods
-    void add_coverage_group(std::unique_ptr<CoverageGroup> group);
-    void add_hierarchy_instance(std::unique_ptr<HierarchyInstance> instance);
-    void add_module_definition(std::unique_ptr<ModuleDefinition> module);
-    void add_assert_coverage(std::unique_ptr<AssertCoverage> assert_cov);
+    void add_coverage_group(RecordPtr<CoverageGroup> group);
+    void add_hierarchy_instance(RecordPtr<HierarchyInstance> instance);
+    void add_module_definition(RecordPtr<ModuleDefinition> module);
+    void add_assert_coverage(RecordPtr<AssertCoverage> assert_cov);
     
     // Utility methods
     void reset();
     bool validate() const;
     double calculate_overall_score() const;
-    std::vector<CoverageGroup*> get_groups_by_pattern(const std::string& pattern) const;
-    std::vector<CoverageGroup*> get_uncovered_groups() const;
+    std::vector<const CoverageGroup*> get_groups_by_pattern(const std::string& pattern) const;
+    std::vector<const CoverageGroup*> get_uncovered_groups() const;
     std::unique_ptr<CoverageStatistics> generate_statistics() const;
     
-    // Iterator support for range-based loops
-    auto groups_begin() { return groups_table.begin(); }
+    /**
+     * @brief Columnar snapshot of the coverage groups, rebuilt if stale
+     * 
+     * Safe to call from several threads at once. The reference stays valid
+     * until the groups are next modified.
+     */
+    const GroupColumns& group_columns() const;
+    void invalidate_group_columns() { group_columns_valid_.store(false, std::memory_order_release); }
+    
+    /**
+     * @brief Parent/child index of the hierarchy instances, with fresh rollups
+     * 
+     * Safe to call from several threads at once. The reference stays valid
+     * until the instances are next modified.
+     */
+    const HierarchyTree& hierarchy_tree() const;
+    void invalidate_hierarchy_rollups() { hierarchy_rollups_valid_.store(false, std::memory_order_release); }
+    
+    /**
+     * @brief Name-sorted indexes of the tables, for prefix and scope queries
+     * 
+     * Safe to call from several threads at once. A reference stays valid
+     * until records are next added to its table.
+     */
+    const NameIndex<CoverageGroup>& group_index() const;
+    const NameIndex<HierarchyInstance>& instance_index() const;
+    const NameIndex<AssertCoverage>& assert_index() const;
+    
+    /**
+     * @brief Records named @p scope or below it ("tb.cpu" matches "tb.cpu.alu"
+     *        and "tb.cpu::cg", not "tb.cpu2"), in O(log n + result size)
+     */
+    std::vector<const CoverageGroup*> get_groups_in_scope(std::string_view scope) const;
+    std::vector<HierarchyInstance*> get_instances_in_scope(std::string_view scope) const;
+    std::vector<AssertCoverage*> get_asserts_in_scope(std::string_view scope) const;
+    
+    /**
+     * @brief Trigram indexes of the tables, for substring and glob queries
+     * 
+     * Same lifetime and thread-safety rules as the name indexes.
+     */
+    const TrigramIndex<CoverageGroup>& group_trigrams() const;
+    const TrigramIndex<HierarchyInstance>& instance_trigrams() const;
+    const TrigramIndex<AssertCoverage>& assert_trigrams() const;
+    
+    // Substring and whole-name glob ('*', '?') searches, in table order
+    std::vector<HierarchyInstance*> get_instances_by_pattern(std::string_view pattern) const;
+    std::vector<AssertCoverage*> get_asserts_by_pattern(std::string_view pattern) const;
+    std::vector<const CoverageGroup*> get_groups_by_glob(std::string_view glob) const;
+    std::vector<HierarchyInstance*> get_instances_by_glob(std::string_view glob) const;
+    std::vector<AssertCoverage*> get_asserts_by_glob(std::string_view glob) const;
+    
+    /**
+     * @brief Build every name and trigram index now instead of on first query
+     */
+    void build_search_indexes() const;
+    
+    // Group queries for callers that modify the results: like non-const
+    // find_coverage_group(), these discard the cached GroupColumns
+    std::vector<CoverageGroup*> get_groups_by_pattern(const std::string& pattern);
+    std::vector<CoverageGroup*> get_uncovered_groups();
+    std::vector<CoverageGroup*> get_groups_in_scope(std::string_view scope);
+    std::vector<CoverageGroup*> get_groups_by_glob(std::string_view glob);
+    
+    // Iterator support for range-based loops (non-const access may modify groups)
+    auto groups_begin() { invalidate_group_columns(); return groups_table.begin(); }
     auto groups_end() { return groups_table.end(); }
     auto groups_begin() const { return groups_table.cbegin(); }
     auto groups_end() const { return groups_table.cend(); }
     
-    auto hierarchy_begin() { return hierarchy_table.begin(); }
+    auto hierarchy_begin() { invalidate_hierarchy_rollups(); return hierarchy_table.begin(); }
     auto hierarchy_end() { return hierarchy_table.end(); }
     auto hierarchy_begin() const { return hierarchy_table.cbegin(); }
     auto hierarchy_end() const { return hierarchy_table.cend(); }
     
 private:
+    StorageMode                                                  storage_mode_;
+    std::unique_ptr<performance::MemoryPool>                     arena_;                     /**< Record storage in ARENA mode */
+    StringInterner                                               strings_;                   /**< Interned names, paths and table keys */
+    
+    mutable GroupColumns                                         group_columns_;             /**< Cached columnar view of groups_table */
+    mutable std::atomic<bool>                                    group_columns_valid_{false};
+    mutable std::mutex                                           group_columns_mutex_;       /**< Serializes rebuilds */
+    
+    mutable HierarchyTree                                        hierarchy_tree_;            /**< Built by add_hierarchy_instance() */
+    mutable std::atomic<bool>                                    hierarchy_rollups_valid_{false};
+    mutable std::mutex                                           hierarchy_rollups_mutex_;   /**< Serializes rollup updates */
+    
+    mutable NameIndex<CoverageGroup>                             group_index_;
+    mutable NameIndex<HierarchyInstance>                         instance_index_;
+    mutable NameIndex<AssertCoverage>                            assert_index_;
+    mutable std::atomic<bool>                                    group_index_valid_{false};
+    mutable std::atomic<bool>                                    instance_index_valid_{false};
+    mutable std::atomic<bool>                                    assert_index_valid_{false};
+    mutable TrigramIndex<CoverageGroup>                          group_trigrams_;
+    mutable TrigramIndex<HierarchyInstance>                      instance_trigrams_;
+    mutable TrigramIndex<AssertCoverage>                         assert_trigrams_;
+    mutable std::atomic<bool>                                    group_trigrams_valid_{false};
+    mutable std::atomic<bool>                                    instance_trigrams_valid_{false};
+    mutable std::atomic<bool>                                    assert_trigrams_valid_{false};
+    mutable std::mutex                                           search_index_mutex_;        /**< Serializes index rebuilds */
+    
+    struct IngestShards;
+    std::unique_ptr<IngestShards>                                ingest_;                    /**< Open sharded ingest, if any */
+    
     void update_timestamp() { last_updated = std::chrono::system_clock::now(); }
+    void clear_tables();
+    void invalidate_search_indexes();
+    
+    template <typename Index, typename Table>
+    const Index& cached_index(Index& index, std::atomic<bool>& valid, const Table& table) const;
+    
+    template <typename T>
+    RecordPtr<T> create_record();
+    
+    template <typename T>
+    void reserve_records(FlatHashMap<std::string_view, RecordPtr<T>>& table, std::size_t count);
 };
 
 // Utility functions
@@ -876,4 +1334,13 @@ std::ostream& operator<<(std::ostream& os, const CoverageGroup& group);
 
 } // namespace coverage_parser
 
+namespace std {
+template <>
+struct hash<coverage_parser::RecordString> {
+    std::size_t operator()(const coverage_parser::RecordString& text) const noexcept {
+        return std::hash<std::string_view>()(text.view());
+    }
+};
+} // namespace std
+
 #endif /* COVERAGE_TYPES_H */
\ No newline at end of file
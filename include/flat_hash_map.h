@@ -0,0 +1,483 @@
+/**
+ * @file flat_hash_map.h
+ * @brief Open-addressing hash map with SIMD group probing (Swiss table layout)
+ *
+ * Entries live in one flat slot array next to an array of one-byte control
+ * words. A control byte is EMPTY, DELETED, or the low 7 bits of the entry's
+ * hash (H2). Slots are probed 16 at a time: one SSE2 compare of the group's
+ * control bytes against H2 yields a bit mask of candidate slots, so most
+ * lookups touch one control cache line and one slot, and inserting never
+ * allocates (except to grow the arrays).
+ *
+ * Groups are 16-slot aligned and probed in triangular order, so every group
+ * is visited once before the sequence repeats. The load factor stays below
+ * 7/8, which guarantees each probe sequence ends at an EMPTY byte.
+ *
+ * SSE2 is part of every x86-64 target, so no runtime dispatch is needed;
+ * other targets use a portable byte loop with the same semantics.
+ *
+ * USAGE EXAMPLE:
+ * ```cpp
+ * FlatHashMap<std::string_view, int> counts;
+ * counts["tb.cpu.alu"] += 1;
+ * for (const auto& [name, count] : counts) {
+ *     std::cout << name << ": " << count << std::endl;
+ * }
+ * ```
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#ifndef FLAT_HASH_MAP_H
+#define FLAT_HASH_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FLAT_HASH_MAP_SSE2 1
+#include <emmintrin.h>
+#else
+#define FLAT_HASH_MAP_SSE2 0
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace coverage_parser {
+
+namespace flat_hash_detail {
+
+using ctrl_t = std::int8_t;
+
+constexpr ctrl_t CTRL_EMPTY = -128;   // 0b10000000
+constexpr ctrl_t CTRL_DELETED = -2;   // 0b11111110; FULL bytes are 0..127 (H2)
+constexpr std::size_t GROUP_WIDTH = 16;
+
+inline std::uint32_t lowest_bit_index(std::uint32_t mask) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<std::uint32_t>(index);
+#else
+    return static_cast<std::uint32_t>(__builtin_ctz(mask));
+#endif
+}
+
+// Spread the user hash so that both H1 (group) and H2 (tag) get good bits,
+// even from identity hashes of integers
+inline std::uint64_t mix_hash(std::size_t hash) {
+    std::uint64_t x = static_cast<std::uint64_t>(hash);
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return x;
+}
+
+/**
+ * @brief The 16 control bytes of one probe group
+ *
+ * Each match returns a bit mask with bit i set for slot i of the group.
+ */
+class Group {
+public:
+    explicit Group(const ctrl_t* ctrl) {
+#if FLAT_HASH_MAP_SSE2
+        ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+#else
+        std::memcpy(ctrl_, ctrl, GROUP_WIDTH);
+#endif
+    }
+
+    std::uint32_t match(ctrl_t h2) const {
+#if FLAT_HASH_MAP_SSE2
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl_, _mm_set1_epi8(h2))));
+#else
+        std::uint32_t mask = 0;
+        for (std::size_t i = 0; i < GROUP_WIDTH; ++i) {
+            mask |= static_cast<std::uint32_t>(ctrl_[i] == h2) << i;
+        }
+        return mask;
+#endif
+    }
+
+    std::uint32_t match_empty() const { return match(CTRL_EMPTY); }
+
+    // EMPTY and DELETED are the only control bytes with the sign bit set
+    std::uint32_t match_empty_or_deleted() const {
+#if FLAT_HASH_MAP_SSE2
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl_));
+#else
+        std::uint32_t mask = 0;
+        for (std::size_t i = 0; i < GROUP_WIDTH; ++i) {
+            mask |= static_cast<std::uint32_t>(ctrl_[i] < 0) << i;
+        }
+        return mask;
+#endif
+    }
+
+private:
+#if FLAT_HASH_MAP_SSE2
+    __m128i ctrl_;
+#else
+    ctrl_t ctrl_[GROUP_WIDTH];
+#endif
+};
+
+} // namespace flat_hash_detail
+
+/**
+ * @brief Swiss-table style hash map
+ *
+ * Mirrors the subset of the std::unordered_map interface used by the
+ * library. Differences: values are stored inline and move when the table
+ * grows, so pointers and iterators to entries are invalidated by any
+ * insertion; iteration order is unspecified and changes on growth.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class FlatHashMap {
+    using ctrl_t = flat_hash_detail::ctrl_t;
+    using Group = flat_hash_detail::Group;
+    static constexpr std::size_t GROUP_WIDTH = flat_hash_detail::GROUP_WIDTH;
+
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<const Key, Value>;
+    using size_type = std::size_t;
+
+    template <bool IsConst>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = FlatHashMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+        using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+
+        Iterator() = default;
+
+        // iterator -> const_iterator
+        template <bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+        Iterator(const Iterator<WasConst>& other) : ctrl_(other.ctrl_), end_(other.end_), slot_(other.slot_) {}
+
+        reference operator*() const { return *slot_; }
+        pointer operator->() const { return slot_; }
+
+        Iterator& operator++() {
+            ++ctrl_;
+            ++slot_;
+            skip_free_slots();
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const Iterator& other) const { return ctrl_ == other.ctrl_; }
+        bool operator!=(const Iterator& other) const { return ctrl_ != other.ctrl_; }
+
+    private:
+        friend class FlatHashMap;
+        template <bool> friend class Iterator;
+
+        Iterator(const ctrl_t* ctrl, const ctrl_t* end, pointer slot) : ctrl_(ctrl), end_(end), slot_(slot) {
+            skip_free_slots();
+        }
+
+        void skip_free_slots() {
+            while (ctrl_ != end_ && *ctrl_ < 0) {
+                ++ctrl_;
+                ++slot_;
+            }
+        }
+
+        const ctrl_t* ctrl_ = nullptr;
+        const ctrl_t* end_ = nullptr;
+        pointer slot_ = nullptr;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    FlatHashMap() = default;
+    ~FlatHashMap() { destroy_and_free(); }
+
+    FlatHashMap(const FlatHashMap&) = delete;
+    FlatHashMap& operator=(const FlatHashMap&) = delete;
+
+    FlatHashMap(FlatHashMap&& other) noexcept { swap(other); }
+    FlatHashMap& operator=(FlatHashMap&& other) noexcept {
+        if (this != &other) {
+            destroy_and_free();
+            swap(other);
+        }
+        return *this;
+    }
+
+    void swap(FlatHashMap& other) noexcept {
+        std::swap(ctrl_, other.ctrl_);
+        std::swap(slots_, other.slots_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(size_, other.size_);
+        std::swap(growth_left_, other.growth_left_);
+        std::swap(hasher_, other.hasher_);
+        std::swap(key_equal_, other.key_equal_);
+    }
+
+    // Iteration
+    iterator begin() { return iterator(ctrl_, ctrl_ + capacity_, slots_); }
+    iterator end() { return iterator(ctrl_ + capacity_, ctrl_ + capacity_, slots_ + capacity_); }
+    const_iterator begin() const { return cbegin(); }
+    const_iterator end() const { return cend(); }
+    const_iterator cbegin() const { return const_iterator(ctrl_, ctrl_ + capacity_, slots_); }
+    const_iterator cend() const { return const_iterator(ctrl_ + capacity_, ctrl_ + capacity_, slots_ + capacity_); }
+
+    // Capacity
+    bool empty() const { return size_ == 0; }
+    size_type size() const { return size_; }
+    size_type capacity() const { return capacity_; }
+
+    /**
+     * @brief Size the table so that @p count entries fit without growing
+     */
+    void reserve(size_type count) {
+        if (count > size_ + growth_left_) {
+            rehash(capacity_for(count));
+        }
+    }
+
+    /**
+     * @brief Destroy every entry, keeping the arrays for reuse
+     */
+    void clear() {
+        if (size_ > 0) {
+            destroy_entries();
+        }
+        if (capacity_ > 0) {
+            std::memset(ctrl_, static_cast<unsigned char>(flat_hash_detail::CTRL_EMPTY), capacity_);
+        }
+        size_ = 0;
+        growth_left_ = max_load(capacity_);
+    }
+
+    // Lookup
+    iterator find(const Key& key) {
+        size_type index;
+        return find_index(key, hash_of(key), index) ? iterator_at(index) : end();
+    }
+    const_iterator find(const Key& key) const {
+        size_type index;
+        return find_index(key, hash_of(key), index) ? const_iterator_at(index) : cend();
+    }
+    bool contains(const Key& key) const {
+        size_type index;
+        return find_index(key, hash_of(key), index);
+    }
+    size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+    // Modifiers
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        auto [index, found] = find_or_prepare_insert(key);
+        if (!found) {
+            new (&slots_[index]) value_type(std::piecewise_construct,
+                                            std::forward_as_tuple(key),
+                                            std::forward_as_tuple(std::forward<Args>(args)...));
+        }
+        return {iterator_at(index), !found};
+    }
+
+    template <typename V>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, V&& value) {
+        auto result = try_emplace(key, std::forward<V>(value));
+        if (!result.second) {
+            result.first->second = std::forward<V>(value);
+        }
+        return result;
+    }
+
+    Value& operator[](const Key& key) { return try_emplace(key).first->second; }
+
+    size_type erase(const Key& key) {
+        size_type index;
+        if (!find_index(key, hash_of(key), index)) {
+            return 0;
+        }
+        slots_[index].~value_type();
+        --size_;
+
+        // A group that still has an EMPTY byte ends every probe that reaches
+        // it, so no probe can have passed through this slot: free it for good
+        const size_type group_start = index & ~(GROUP_WIDTH - 1);
+        if (Group(ctrl_ + group_start).match_empty()) {
+            ctrl_[index] = flat_hash_detail::CTRL_EMPTY;
+            ++growth_left_;
+        } else {
+            ctrl_[index] = flat_hash_detail::CTRL_DELETED;
+        }
+        return 1;
+    }
+
+private:
+    ctrl_t* ctrl_ = nullptr;
+    value_type* slots_ = nullptr;
+    size_type capacity_ = 0;     // 0 or a power of two >= GROUP_WIDTH
+    size_type size_ = 0;
+    size_type growth_left_ = 0;  // Inserts into EMPTY slots left before a rehash
+    Hash hasher_;
+    KeyEqual key_equal_;
+
+    static_assert(alignof(value_type) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+                  "FlatHashMap slots must not need over-aligned allocation");
+
+    static size_type max_load(size_type capacity) { return capacity - capacity / 8; }
+
+    static size_type capacity_for(size_type count) {
+        size_type capacity = GROUP_WIDTH;
+        while (max_load(capacity) < count) {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    std::uint64_t hash_of(const Key& key) const { return flat_hash_detail::mix_hash(hasher_(key)); }
+
+    static ctrl_t h2(std::uint64_t hash) { return static_cast<ctrl_t>(hash & 0x7F); }
+    static size_type h1(std::uint64_t hash) { return static_cast<size_type>(hash >> 7); }
+
+    iterator iterator_at(size_type index) { return iterator(ctrl_ + index, ctrl_ + capacity_, slots_ + index); }
+    const_iterator const_iterator_at(size_type index) const {
+        return const_iterator(ctrl_ + index, ctrl_ + capacity_, slots_ + index);
+    }
+
+    bool find_index(const Key& key, std::uint64_t hash, size_type& index) const {
+        if (capacity_ == 0) {
+            return false;
+        }
+        const size_type group_mask = capacity_ / GROUP_WIDTH - 1;
+        size_type group = h1(hash) & group_mask;
+        const ctrl_t tag = h2(hash);
+        for (size_type step = 1;; ++step) {
+            const size_type base = group * GROUP_WIDTH;
+            Group control(ctrl_ + base);
+            for (std::uint32_t mask = control.match(tag); mask != 0; mask &= mask - 1) {
+                const size_type candidate = base + flat_hash_detail::lowest_bit_index(mask);
+                if (key_equal_(slots_[candidate].first, key)) {
+                    index = candidate;
+                    return true;
+                }
+            }
+            if (control.match_empty()) {
+                return false;
+            }
+            group = (group + step) & group_mask;
+        }
+    }
+
+    // First EMPTY or DELETED slot on the probe sequence of `hash`
+    size_type find_insert_slot(std::uint64_t hash) const {
+        const size_type group_mask = capacity_ / GROUP_WIDTH - 1;
+        size_type group = h1(hash) & group_mask;
+        for (size_type step = 1;; ++step) {
+            const size_type base = group * GROUP_WIDTH;
+            std::uint32_t mask = Group(ctrl_ + base).match_empty_or_deleted();
+            if (mask != 0) {
+                return base + flat_hash_detail::lowest_bit_index(mask);
+            }
+            group = (group + step) & group_mask;
+        }
+    }
+
+    // Returns the entry's slot; when not found, the slot is claimed but unconstructed
+    std::pair<size_type, bool> find_or_prepare_insert(const Key& key) {
+        const std::uint64_t hash = hash_of(key);
+        size_type index;
+        if (find_index(key, hash, index)) {
+            return {index, true};
+        }
+
+        if (growth_left_ == 0) {
+            // Grow, unless tombstones rather than live entries filled the table
+            size_type target = size_ + 1;
+            if (target * 2 > max_load(capacity_)) {
+                target = max_load(capacity_) + 1;
+            }
+            rehash(capacity_for(target));
+        }
+
+        index = find_insert_slot(hash);
+        if (ctrl_[index] == flat_hash_detail::CTRL_EMPTY) {
+            --growth_left_;
+        }
+        ctrl_[index] = h2(hash);
+        ++size_;
+        return {index, false};
+    }
+
+    void rehash(size_type new_capacity) {
+        ctrl_t* old_ctrl = ctrl_;
+        value_type* old_slots = slots_;
+        const size_type old_capacity = capacity_;
+
+        allocate(new_capacity);
+        for (size_type i = 0; i < old_capacity; ++i) {
+            if (old_ctrl[i] >= 0) {
+                const std::uint64_t hash = hash_of(old_slots[i].first);
+                const size_type index = find_insert_slot(hash);
+                ctrl_[index] = h2(hash);
+                new (&slots_[index]) value_type(std::move(old_slots[i]));
+                old_slots[i].~value_type();
+            }
+        }
+        growth_left_ = max_load(capacity_) - size_;
+
+        if (old_ctrl) {
+            ::operator delete(old_ctrl);
+        }
+    }
+
+    // One block: control bytes first, then the slot array
+    void allocate(size_type capacity) {
+        const size_type ctrl_bytes = (capacity + alignof(value_type) - 1) & ~(alignof(value_type) - 1);
+        char* memory = static_cast<char*>(::operator new(ctrl_bytes + capacity * sizeof(value_type)));
+        ctrl_ = reinterpret_cast<ctrl_t*>(memory);
+        slots_ = reinterpret_cast<value_type*>(memory + ctrl_bytes);
+        capacity_ = capacity;
+        std::memset(ctrl_, static_cast<unsigned char>(flat_hash_detail::CTRL_EMPTY), capacity);
+    }
+
+    void destroy_entries() {
+        for (size_type i = 0; i < capacity_; ++i) {
+            if (ctrl_[i] >= 0) {
+                slots_[i].~value_type();
+            }
+        }
+    }
+
+    void destroy_and_free() {
+        if (ctrl_) {
+            destroy_entries();
+            ::operator delete(ctrl_);
+            ctrl_ = nullptr;
+            slots_ = nullptr;
+        }
+        capacity_ = size_ = growth_left_ = 0;
+    }
+};
+
+} // namespace coverage_parser
+
+#endif /* FLAT_HASH_MAP_H */
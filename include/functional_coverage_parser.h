@@ -63,12 +63,14 @@
 #define FUNCTIONAL_COVERAGE_PARSER_H
 
 #include "coverage_types.h"
+#include "line_tokenizer.h"
 #include <iostream>
 #include <fstream>
 #include <string>
 #include <memory>
 #include <vector>
 #include <chrono>
+#include <string_view>
 
 namespace coverage_parser {
 
@@ -89,6 +91,8 @@ constexpr const char* VERSION_STRING = "1.0.0";
     #define COVERAGE_PARSER_API
 #endif
 
+class RecordVisitor;
+
 /**
  * @brief Base parser interface for all coverage file parsers
  * 
@@ -149,6 +153,23 @@ public:
      */
     virtual ParserResult parse(const std::string& filename, CoverageDatabase& db) = 0;
     
+    /**
+     * @brief Read a coverage file record by record, without a database
+     * 
+     * Passes each record to @p visitor as a transient view, in fixed memory
+     * (see record_stream.h). Reports that are not a list of records, such
+     * as the dashboard, cannot be streamed.
+     * 
+     * @param filename Path to the coverage file
+     * @param visitor Receives the records
+     * @return ParserResult indicating success or failure
+     */
+    virtual ParserResult stream(const std::string& filename, RecordVisitor& visitor) {
+        (void)filename;
+        (void)visitor;
+        return ParserResult::ERROR_INVALID_PARAMETER;
+    }
+    
     /**
      * @brief Set parser configuration
      * @param config Configuration options for parsing
@@ -219,9 +240,9 @@ public:
     std::string get_parser_info() const override { return "Dashboard Parser v1.0"; }
     
 private:
-    ParserResult parse_header_section(std::ifstream& file, DashboardData& dashboard);
-    ParserResult parse_coverage_summary(std::ifstream& file, DashboardData& dashboard);
-    ParserResult parse_hierarchical_instances(std::ifstream& file, DashboardData& dashboard);
+    ParserResult parse_header_section(std::istream& file, DashboardData& dashboard);
+    ParserResult parse_coverage_summary(std::istream& file, DashboardData& dashboard);
+    ParserResult parse_hierarchical_instances(std::istream& file, DashboardData& dashboard);
     bool is_header_line(const std::string& line) const;
     bool is_coverage_summary_line(const std::string& line) const;
 };
@@ -283,14 +304,8 @@ public:
     ~GroupsParser() override = default;
     
     ParserResult parse(const std::string& filename, CoverageDatabase& db) override;
+    ParserResult stream(const std::string& filename, RecordVisitor& visitor) override;
     std::string get_parser_info() const override { return "Groups Parser v1.0"; }
-    
-private:
-    ParserResult parse_header_section(std::ifstream& file);
-    ParserResult parse_group_entry(const std::string& line, CoverageDatabase& db);
-    bool is_group_data_line(const std::string& line) const;
-    bool is_header_line(const std::string& line) const;
-    std::vector<std::string> split_group_line(const std::string& line) const;
 };
 
 /**
@@ -340,14 +355,12 @@ public:
     ~HierarchyParser() override = default;
     
     ParserResult parse(const std::string& filename, CoverageDatabase& db) override;
+    ParserResult stream(const std::string& filename, RecordVisitor& visitor) override;
     std::string get_parser_info() const override { return "Hierarchy Parser v1.0"; }
     
-private:
-    ParserResult parse_hierarchy_entry(const std::string& line, CoverageDatabase& db);
-    bool is_hierarchy_data_line(const std::string& line) const;
-    bool is_header_line(const std::string& line) const;
-    std::vector<std::string> split_hierarchy_line(const std::string& line) const;
-    std::uint32_t calculate_depth_level(const std::string& instance_path) const;
+protected:
+    std::uint32_t calculate_depth_level(std::string_view instance_path) const;
+    void classify_instance(HierarchyInstance& instance, CoverageDatabase& db) const;
 };
 
 /**
@@ -399,13 +412,8 @@ public:
     ~ModuleListParser() override = default;
     
     ParserResult parse(const std::string& filename, CoverageDatabase& db) override;
+    ParserResult stream(const std::string& filename, RecordVisitor& visitor) override;
     std::string get_parser_info() const override { return "Module List Parser v1.0"; }
-    
-private:
-    ParserResult parse_module_entry(const std::string& line, CoverageDatabase& db);
-    bool is_module_data_line(const std::string& line) const;
-    bool is_header_line(const std::string& line) const;
-    std::vector<std::string> split_module_line(const std::string& line) const;
 };
 
 /**
@@ -458,13 +466,8 @@ public:
     ~AssertParser() override = default;
     
     ParserResult parse(const std::string& filename, CoverageDatabase& db) override;
+    ParserResult stream(const std::string& filename, RecordVisitor& visitor) override;
     std::string get_parser_info() const override { return "Assert Parser v1.0"; }
-    
-private:
-    ParserResult parse_assert_entry(const std::string& line, CoverageDatabase& db);
-    bool is_assert_data_line(const std::string& line) const;
-    bool is_header_line(const std::string& line) const;
-    std::vector<std::string> split_assert_line(const std::string& line) const;
 };
 
 /**
@@ -624,6 +627,28 @@ unsigned int parse_uint(const std::string& str, unsigned int default_value = 0);
 /// Parse string to double with default value
 double parse_double(const std::string& str, double default_value = 0.0);
 
+/**
+ * @brief Exception-free numeric parsing on string_view fields
+ * 
+ * Built on std::from_chars: no allocation, no exceptions, no locale. The
+ * whole field must be the number (no surrounding whitespace, no trailing
+ * characters); an optional leading '+' is accepted. On failure the output is
+ * left unchanged and false is returned.
+ */
+bool try_parse_uint(std::string_view text, std::uint32_t& value) noexcept;
+
+/// Signed variant of try_parse_uint
+bool try_parse_int(std::string_view text, std::int32_t& value) noexcept;
+
+/// Floating-point variant of try_parse_uint (decimal and exponent notation)
+bool try_parse_double(std::string_view text, double& value) noexcept;
+
+/// Parse a "covered/expected" fraction such as "60148/272087"
+bool try_parse_fraction(std::string_view text, std::uint32_t& covered, std::uint32_t& expected) noexcept;
+
+/// Parse the count of a report header line such as "Total groups in report: 16295"
+bool try_parse_declared_total(std::string_view line, std::string_view label, std::uint32_t& count) noexcept;
+
 /// Check if string represents a valid number
 bool is_number(const std::string& str);
 
@@ -672,6 +697,27 @@ bool file_exists(const std::string& filepath);
 /// Get file size in bytes
 std::size_t get_file_size(const std::string& filepath);
 
+/// Typical data line lengths, for estimating record counts from file sizes
+constexpr std::size_t TYPICAL_GROUP_LINE_BYTES = 100;
+constexpr std::size_t TYPICAL_HIERARCHY_LINE_BYTES = 100;
+constexpr std::size_t TYPICAL_MODULE_LINE_BYTES = 80;
+constexpr std::size_t TYPICAL_ASSERT_LINE_BYTES = 100;
+
+/// Shortest data line of any report format ("0/1 a b" and its newline)
+constexpr std::size_t MIN_RECORD_LINE_BYTES = 8;
+
+/**
+ * @brief Number of records to pre-size for before parsing a report
+ * 
+ * The total the report header declares, or, when the header has none
+ * (@p declared_total is 0), the file size over a typical line length.
+ * A declared total is only trusted up to the number of lines the file can
+ * hold, so a corrupt header cannot request gigabytes. Capped at @p limit
+ * unless it is 0.
+ */
+std::size_t expected_record_count(std::uint32_t declared_total, std::size_t file_bytes,
+                                  std::size_t typical_line_bytes, std::uint32_t limit = 0) noexcept;
+
 /** @} */
 
 /**
@@ -84,6 +84,15 @@ COVERAGE_PARSER_API const char* get_error_string(int result);
  */
 COVERAGE_PARSER_API void* create_coverage_database();
 
+/**
+ * @brief Create coverage database with arena record storage
+ * 
+ * Records and their strings are allocated in large blocks owned by the
+ * database, so destroying a database with millions of records is cheap.
+ * @return Database handle or NULL on failure
+ */
+COVERAGE_PARSER_API void* create_arena_coverage_database();
+
 /**
  * @brief Destroy coverage database
  * @param handle Database handle
@@ -113,13 +122,13 @@ COVERAGE_PARSER_API double calculate_overall_score(void* db_handle);
  */
 
 /**
- * @brief Create dashboard parser
+ * @brief Create dashboard parser (high-performance optimized)
  * @return Parser handle or NULL on failure
  */
 COVERAGE_PARSER_API void* create_dashboard_parser();
 
 /**
- * @brief Create module list parser
+ * @brief Create module list parser (high-performance optimized)
  * @return Parser handle or NULL on failure
  */
 COVERAGE_PARSER_API void* create_modlist_parser();
@@ -183,6 +192,122 @@ COVERAGE_PARSER_API int get_num_modules(void* db_handle);
  */
 COVERAGE_PARSER_API int get_num_asserts(void* db_handle);
 
+/**
+ * @brief Coverage metrics of a single record, filled by the find functions
+ */
+typedef struct {
+    double score;                   /** Coverage score in percent */
+    uint32_t covered;               /** Covered items (assertions: 1 if covered) */
+    uint32_t expected;              /** Coverable items (assertions: 1) */
+    uint32_t hit_count;             /** Hit count (assertions only, else 0) */
+} RecordMetrics;
+
+/**
+ * @brief Look up a coverage group by full name
+ * 
+ * Lookups do not allocate, so they are suited to cross-referencing jobs
+ * that query millions of names.
+ * 
+ * @param db_handle Database handle
+ * @param name Full group name
+ * @param metrics Output group coverage (may be NULL to test existence)
+ * @return 1 if found, 0 if not found, -1 on error
+ */
+COVERAGE_PARSER_API int find_coverage_group(void* db_handle, const char* name, RecordMetrics* metrics);
+
+/**
+ * @brief Look up a hierarchy instance by full path
+ * @param db_handle Database handle
+ * @param path Full instance path
+ * @param metrics Output total score and assertion counts (may be NULL)
+ * @return 1 if found, 0 if not found, -1 on error
+ */
+COVERAGE_PARSER_API int find_hierarchy_instance(void* db_handle, const char* path, RecordMetrics* metrics);
+
+/**
+ * @brief Look up a module definition by name
+ * @param db_handle Database handle
+ * @param name Module name
+ * @param metrics Output total score and assertion counts (may be NULL)
+ * @return 1 if found, 0 if not found, -1 on error
+ */
+COVERAGE_PARSER_API int find_module_definition(void* db_handle, const char* name, RecordMetrics* metrics);
+
+/**
+ * @brief Look up an assertion by name
+ * @param db_handle Database handle
+ * @param name Assertion name
+ * @param metrics Output coverage status and hit count (may be NULL)
+ * @return 1 if found, 0 if not found, -1 on error
+ */
+COVERAGE_PARSER_API int find_assert_coverage(void* db_handle, const char* name, RecordMetrics* metrics);
+
+/** @} */
+
+/**
+ * @defgroup Streaming Streaming Functions
+ * @brief Record-by-record reading without a database
+ * @{
+ */
+
+/**
+ * @brief Kind of a streamed record
+ */
+typedef enum {
+    RECORD_GROUP = 0,
+    RECORD_HIERARCHY_INSTANCE = 1,
+    RECORD_MODULE = 2,
+    RECORD_ASSERT = 3
+} StreamRecordKind;
+
+/**
+ * @brief Text field of a streamed record, UTF-8 and not NUL-terminated
+ */
+typedef struct {
+    const char* data;
+    uint32_t length;
+} RecordText;
+
+/**
+ * @brief One streamed record
+ * 
+ * The text fields point into the reader's line buffer: copy them before
+ * the callback returns if they are needed later. Fields that do not apply
+ * to the record's kind are empty or 0.
+ */
+typedef struct {
+    int kind;                       /** StreamRecordKind */
+    RecordText name;                /** Group name, instance path, module name or assertion name */
+    RecordText module_name;         /** Hierarchy instances: last path component */
+    RecordText instance_path;       /** Assertions: instance holding the assertion */
+    RecordText file_location;       /** Assertions: source file */
+    RecordText severity;            /** Assertions: status keyword */
+    RecordMetrics metrics;          /** As filled by the find functions */
+    uint32_t line_number;           /** Assertions: line in file_location */
+    uint32_t depth_level;           /** Hierarchy instances: depth below the top */
+} StreamedRecord;
+
+/**
+ * @brief Receives each streamed record
+ * @return Nonzero to continue, 0 to stop the stream
+ */
+typedef int (*RecordCallback)(const StreamedRecord* record, void* user_data);
+
+/**
+ * @brief Read a coverage file record by record, without a database
+ * 
+ * Calls @p callback once per record, in file order, in fixed memory
+ * whatever the file's size. The parser's kind selects the format; the
+ * dashboard parser cannot stream. The parse cache is not used.
+ * 
+ * @param parser_handle Groups, hierarchy, assert or module list parser handle
+ * @param filename Path to coverage file
+ * @param callback Called for each record on the calling thread
+ * @param user_data Passed to @p callback unchanged
+ * @return Parser result code (0 = success, including a stop requested by @p callback)
+ */
+COVERAGE_PARSER_API int stream_coverage_file(void* parser_handle, const char* filename, RecordCallback callback, void* user_data);
+
 /** @} */
 
 /**
@@ -282,11 +407,42 @@ COVERAGE_PARSER_API int get_performance_stats(void* parser_handle, PerformanceSt
  * based on file size and system capabilities.
  * 
  * @param filename Path to coverage file to analyze
- * @param parser_type "groups", "hierarchy", "assert", etc.
+ * @param parser_type "groups", "hierarchy", "assert", "dashboard" or "modlist"
  * @return Parser handle or NULL on error
  */
 COVERAGE_PARSER_API void* create_optimal_parser(const char* filename, const char* parser_type);
 
+/**
+ * @brief Set the number of worker threads used by high-performance parsers
+ * 
+ * All parser handles share one library-wide thread pool, so concurrent
+ * parse calls never run more than this many worker threads in total.
+ * Parses already in progress finish on the previous pool.
+ * 
+ * @param num_threads Worker count (at most 1024), 0 for one per hardware thread
+ * @return Parser result code (0 = success)
+ */
+COVERAGE_PARSER_API int set_thread_pool_size(uint32_t num_threads);
+
+/**
+ * @brief Get the number of worker threads in the shared thread pool
+ * @return Worker thread count
+ */
+COVERAGE_PARSER_API uint32_t get_thread_pool_size();
+
+/**
+ * @brief Cache parse results in a local directory
+ * 
+ * While set, parse_coverage_file() keys each report by its size, last
+ * write time and a hash of sampled content blocks, and loads the stored
+ * database image instead of parsing a report it has seen unchanged.
+ * Entries written by one process are reused by the next.
+ * 
+ * @param directory Cache directory (created if missing), NULL or "" to disable
+ * @return Parser result code (0 = success)
+ */
+COVERAGE_PARSER_API int set_parse_cache_directory(const char* directory);
+
 /** @} */
 
 /**
@@ -307,7 +463,7 @@ COVERAGE_PARSER_API int get_memory_usage(uint32_t* total_bytes, uint32_t* num_al
  * @brief Cleanup library resources
  * 
  * Call this function before unloading the DLL to ensure proper cleanup
- * of all allocated resources.
+ * of all allocated resources, including the shared thread pool's workers.
  */
 COVERAGE_PARSER_API void cleanup_library();
 
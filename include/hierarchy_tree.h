@@ -0,0 +1,159 @@
+/**
+ * @file hierarchy_tree.h
+ * @brief Tree index over the design hierarchy with subtree coverage rollups
+ *
+ * hierarchy_table maps full instance paths to records, which answers
+ * "what is tb.cpu.alu" but not "what is under tb.cpu" without scanning every
+ * path. A HierarchyTree gives each path component a dense node ID and links
+ * the nodes with parent, first-child and next-sibling arrays, so a subtree is
+ * walked in O(subtree) and its coverage totals are a single array read.
+ *
+ * Ancestors that have no record of their own (a report may list only
+ * leaves) still get nodes, so every instance is reachable from a root.
+ * An ancestor's node is always created before its descendants' nodes, so
+ * parent IDs are smaller than child IDs and rollups fold up in one reverse pass.
+ *
+ * USAGE EXAMPLE:
+ * ```cpp
+ * const HierarchyTree& tree = db.hierarchy_tree();
+ * SubtreeCoverage cpu = tree.subtree_coverage("tb.cpu");   // Everything under tb.cpu.*
+ * std::cout << cpu.assert_score() << "% of " << cpu.instances << " instances" << std::endl;
+ *
+ * tree.for_each_child(tree.find("tb.cpu"), [&](HierarchyTree::NodeId child) {
+ *     std::cout << tree.name(child) << std::endl;
+ * });
+ * ```
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#ifndef HIERARCHY_TREE_H
+#define HIERARCHY_TREE_H
+
+#include "flat_hash_map.h"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace coverage_parser {
+
+class HierarchyInstance;
+
+/**
+ * @brief Coverage totals of a node and all of its descendants
+ */
+struct SubtreeCoverage {
+    std::uint64_t assert_covered = 0;   /**< Covered assertions */
+    std::uint64_t assert_expected = 0;  /**< Expected assertions */
+    std::uint64_t group_covered = 0;    /**< Covered group bins */
+    std::uint64_t group_expected = 0;   /**< Expected group bins */
+    std::uint32_t instances = 0;        /**< Instances with a record, including the root */
+
+    double assert_score() const { return assert_expected > 0 ? 100.0 * assert_covered / assert_expected : 0.0; }
+    double group_score() const { return group_expected > 0 ? 100.0 * group_covered / group_expected : 0.0; }
+
+    SubtreeCoverage& operator+=(const SubtreeCoverage& other);
+};
+
+/**
+ * @brief Parent/child index of hierarchy paths ('.'-separated)
+ *
+ * Paths passed to insert() must outlive the tree: the tree keeps views of
+ * them (the database passes its interned table keys). Rollups reflect the
+ * records as of the last update_rollups() call.
+ */
+class HierarchyTree {
+public:
+    using NodeId = std::uint32_t;
+    static constexpr NodeId INVALID_NODE = static_cast<NodeId>(-1);
+
+    /**
+     * @brief Add @p path (and any missing ancestors) with its record
+     * @return The node of @p path; re-inserting a path replaces its record
+     */
+    NodeId insert(std::string_view path, const HierarchyInstance* instance);
+
+    /**
+     * @brief Recompute every node's subtree totals from the records
+     */
+    void update_rollups();
+
+    void reserve(std::size_t nodes);
+    void clear();
+
+    // Lookup
+    NodeId find(std::string_view path) const;
+    std::size_t size() const { return parent_.size(); }
+    bool empty() const { return parent_.empty(); }
+
+    // Node data (node must be < size())
+    NodeId parent(NodeId node) const { return parent_[node]; }
+    NodeId first_child(NodeId node) const { return first_child_[node]; }
+    NodeId next_sibling(NodeId node) const { return next_sibling_[node]; }
+    NodeId first_root() const { return first_root_; }       /**< Roots are chained by next_sibling */
+    std::uint32_t depth(NodeId node) const { return depth_[node]; }
+    std::string_view path(NodeId node) const { return path_[node]; }
+    std::string_view name(NodeId node) const;               /**< Last path component */
+    const HierarchyInstance* instance(NodeId node) const { return instance_[node]; }  /**< nullptr for implicit ancestors */
+    const SubtreeCoverage& subtree(NodeId node) const { return subtree_[node]; }
+
+    /**
+     * @brief Totals of everything at or under @p path (empty if absent)
+     */
+    SubtreeCoverage subtree_coverage(std::string_view path) const;
+
+    template <typename Visitor>
+    void for_each_child(NodeId node, Visitor&& visit) const {
+        for (NodeId child = node < size() ? first_child_[node] : INVALID_NODE; child != INVALID_NODE;
+             child = next_sibling_[child]) {
+            visit(child);
+        }
+    }
+
+    /**
+     * @brief Visit @p root and its descendants in pre-order, without recursion
+     */
+    template <typename Visitor>
+    void for_each_in_subtree(NodeId root, Visitor&& visit) const {
+        if (root >= size()) {
+            return;
+        }
+        NodeId node = root;
+        while (true) {
+            visit(node);
+            if (first_child_[node] != INVALID_NODE) {
+                node = first_child_[node];
+                continue;
+            }
+            while (node != root && next_sibling_[node] == INVALID_NODE) {
+                node = parent_[node];
+            }
+            if (node == root) {
+                return;
+            }
+            node = next_sibling_[node];
+        }
+    }
+
+private:
+    std::vector<NodeId>                       parent_;
+    std::vector<NodeId>                       first_child_;
+    std::vector<NodeId>                       last_child_;     /**< Appends keep children in insertion order */
+    std::vector<NodeId>                       next_sibling_;
+    std::vector<std::uint32_t>                depth_;
+    std::vector<std::string_view>             path_;
+    std::vector<const HierarchyInstance*>     instance_;
+    std::vector<SubtreeCoverage>              subtree_;
+    FlatHashMap<std::string_view, NodeId>     index_;          /**< Path -> node */
+    NodeId                                    first_root_ = INVALID_NODE;
+    NodeId                                    last_root_ = INVALID_NODE;
+
+    NodeId ensure_node(std::string_view path);
+};
+
+} // namespace coverage_parser
+
+#endif /* HIERARCHY_TREE_H */
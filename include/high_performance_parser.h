@@ -25,13 +25,26 @@
 #pragma once
 
 #include "functional_coverage_parser.h"
+#include "memory_pool.h"
+#include <cstddef>
 #include <memory>
 #include <thread>
 #include <vector>
 #include <string_view>
 #include <mutex>
 #include <atomic>
-#include <immintrin.h>  // SIMD intrinsics
+
+// Vector kernels are only built for x86; other targets use the scalar ones
+#if defined(__x86_64__) || defined(_M_X64)
+#define COVERAGE_PARSER_X86 1
+#define COVERAGE_PARSER_X86_64 1
+#elif defined(__i386__) || defined(_M_IX86)
+#define COVERAGE_PARSER_X86 1
+#define COVERAGE_PARSER_X86_64 0
+#else
+#define COVERAGE_PARSER_X86 0
+#define COVERAGE_PARSER_X86_64 0
+#endif
 
 namespace coverage_parser {
 namespace performance {
@@ -41,12 +54,34 @@ namespace performance {
  * 
  * Provides efficient access to file contents through memory mapping,
  * eliminating the need for read() syscalls and buffer copies.
+ * 
+ * PLATFORM BACKENDS:
+ * - Windows: CreateFileA/CreateFileMappingA/MapViewOfFile (sequential scan hint)
+ * - POSIX:   open/mmap with madvise(MADV_SEQUENTIAL) and madvise(MADV_WILLNEED)
+ * 
+ * Empty files and files that cannot be opened or mapped yield an invalid mapping.
+ * 
+ * COMPRESSED REPORTS: with Access::SEQUENTIAL, a gzip or zstd file (see
+ * compressed_input.h) is decompressed into memory and data() points at the
+ * decompressed text, so parsers read it unchanged. A compressed file that is
+ * corrupt or whose format is not compiled in yields an invalid mapping.
+ * Access::RANDOM always maps the bytes on disk.
  */
 class MemoryMappedFile {
 public:
-    MemoryMappedFile(const std::string& filename);
+    // How the mapping will be read, for the kernel's read-ahead policy
+    enum class Access {
+        SEQUENTIAL,   /**< Front to back once (parsers): aggressive read-ahead */
+        RANDOM        /**< Scattered lookups (snapshots): no read-ahead */
+    };
+    
+    MemoryMappedFile(const std::string& filename, Access access = Access::SEQUENTIAL);
     ~MemoryMappedFile();
     
+    // The mapping is owned exclusively; copying would unmap it twice
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+    
     bool is_valid() const { return data_ != nullptr; }
     const char* data() const { return data_; }
     std::size_t size() const { return size_; }
@@ -57,19 +92,68 @@ public:
 private:
     const char* data_ = nullptr;
     std::size_t size_ = 0;
+    std::unique_ptr<char[]> decompressed_;  // Contents of a compressed file; the mapping is released
+#ifdef _WIN32
     void* file_handle_ = nullptr;
     void* mapping_handle_ = nullptr;
+#endif
+    
+    void unmap();
+    void decompress_contents();
 };
 
 /**
  * @brief High-performance string utilities using SIMD instructions
  * 
  * Vectorized string operations for maximum parsing speed on large datasets.
+ * Each operation has scalar, SSE2, AVX2 and AVX-512BW kernels; the widest one
+ * supported by the CPU and OS (checked via cpuid/xgetbv) is selected once when
+ * the library is loaded.
  */
 namespace simd {
     
     /**
-     * @brief Find first occurrence of character using SIMD (SSE/AVX)
+     * @brief Instruction set tiers of the vector kernels, narrowest first
+     */
+    enum class SimdLevel {
+        SCALAR,
+        SSE2,
+        AVX2,
+        AVX512BW
+    };
+    
+    /**
+     * @brief Widest tier supported by this CPU and operating system
+     */
+    SimdLevel detected_simd_level();
+    
+    /**
+     * @brief Tier the kernels were bound to at library load
+     * 
+     * Equal to detected_simd_level() unless the COVERAGE_PARSER_SIMD environment
+     * variable (scalar, sse2, avx2, avx512) asks for a narrower one, e.g. to
+     * compare tiers in benchmarks. It is never raised above the detected tier.
+     */
+    SimdLevel active_simd_level();
+    
+    /**
+     * @brief Rebind the kernels to @p level, capped at detected_simd_level()
+     * 
+     * The programmatic form of COVERAGE_PARSER_SIMD, for tests that compare
+     * tiers within one process. Safe while other threads parse: the kernel
+     * table is swapped atomically, and every tier gives the same results.
+     * 
+     * @return The tier now active
+     */
+    SimdLevel set_active_simd_level(SimdLevel level);
+    
+    /**
+     * @brief Short lowercase name of a tier ("scalar", "sse2", "avx2", "avx512bw")
+     */
+    const char* simd_level_name(SimdLevel level);
+    
+    /**
+     * @brief Find first occurrence of character using SIMD (SSE2/AVX2/AVX-512)
      * Up to 16x faster than standard strchr for large buffers
      */
     const char* find_char_simd(const char* data, std::size_t length, char target);
@@ -77,6 +161,9 @@ namespace simd {
     /**
      * @brief Find newline characters using vectorized search
      * Optimized for finding line boundaries in huge files
+     * 
+     * Materializes every offset (8 bytes per line); use LineScanner to walk
+     * the lines of a large buffer instead.
      */
     std::vector<std::size_t> find_newlines_simd(const char* data, std::size_t length);
     
@@ -92,38 +179,64 @@ namespace simd {
      */
     bool parse_uint_simd(const char* start, const char* end, uint32_t& result);
     bool parse_double_simd(const char* start, const char* end, double& result);
-}
-
-/**
- * @brief Memory pool allocator for reduced allocation overhead
- * 
- * Custom allocator that pre-allocates large chunks and sub-allocates
- * from them to minimize malloc/free overhead during parsing.
- */
-class MemoryPool {
-public:
-    MemoryPool(std::size_t chunk_size = 64 * 1024); // 64KB chunks
-    ~MemoryPool();
-    
-    void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
-    void reset(); // Reset pool for reuse
-    
-    // Statistics
-    std::size_t total_allocated() const { return total_allocated_; }
-    std::size_t chunks_count() const { return chunks_.size(); }
     
-private:
-    struct Chunk {
-        void* memory;
-        std::size_t size;
-        std::size_t used;
+    /**
+     * @brief Streaming line iterator over an in-memory buffer
+     * 
+     * Newlines are indexed one BLOCK_SIZE block at a time with the dispatched
+     * newline kernel, and the lines of that block are handed out while it is
+     * still in cache. Memory use is bounded by the offsets of one block,
+     * whatever the buffer size. A final line without a trailing '\n' is
+     * returned as well.
+     * 
+     * USAGE EXAMPLE:
+     * ```cpp
+     * simd::LineScanner lines(data, size);
+     * for (std::string_view line; lines.next(line);) {
+     *     // line excludes its '\n'
+     * }
+     * ```
+     */
+    class LineScanner {
+    public:
+        static constexpr std::size_t BLOCK_SIZE = 16 * 1024;
+        
+        LineScanner(const char* data, std::size_t length);
+        
+        /**
+         * @brief Advance to the next line
+         * @return false once the buffer is exhausted
+         */
+        bool next(std::string_view& line) {
+            while (cursor_ == newlines_.size()) {
+                if (scanned_ == end_) {
+                    if (line_start_ == end_) {
+                        return false;
+                    }
+                    line = std::string_view(line_start_, end_ - line_start_);
+                    line_start_ = end_;
+                    return true;
+                }
+                index_next_block();
+            }
+            
+            const char* newline = block_ + newlines_[cursor_++];
+            line = std::string_view(line_start_, newline - line_start_);
+            line_start_ = newline + 1;
+            return true;
+        }
+        
+    private:
+        const char* line_start_;  // First byte of the next line
+        const char* block_;       // Block the newline offsets refer to
+        const char* scanned_;     // End of the indexed region
+        const char* end_;
+        std::vector<std::size_t> newlines_;  // Offsets within the current block
+        std::size_t cursor_ = 0;
+        
+        void index_next_block();
     };
-    
-    std::vector<Chunk> chunks_;
-    std::size_t chunk_size_;
-    std::size_t total_allocated_ = 0;
-    std::mutex mutex_;
-};
+}
 
 /**
  * @brief Parallel processing utilities for multi-threaded parsing
@@ -138,6 +251,7 @@ public:
         std::size_t end_offset;
         std::size_t line_start;  // Adjusted to line boundaries
         std::size_t line_end;    // Adjusted to line boundaries
+        std::size_t expected_records = 0;  // Reserve hint for the chunk's results (0 = estimate from bytes)
     };
     
     static std::vector<FileChunk> create_chunks(
@@ -165,17 +279,19 @@ private:
  * - SIMD operations for string processing
  * - Parallel processing across multiple cores
  * - Memory pools for allocation efficiency
+ * - Sharded ingest, so workers insert their own groups concurrently
  */
-class HighPerformanceGroupsParser {
+class HighPerformanceGroupsParser : public GroupsParser {
 public:
     HighPerformanceGroupsParser();
-    ~HighPerformanceGroupsParser() = default;
+    ~HighPerformanceGroupsParser() override = default;
     
     /**
      * @brief Parse groups file with maximum performance
      * Target: 100MB file in <5 seconds on modern CPU
      */
-    ParserResult parse(const std::string& filename, CoverageDatabase& db);
+    ParserResult parse(const std::string& filename, CoverageDatabase& db) override;
+    std::string get_parser_info() const override { return "High-Performance Groups Parser v2.0"; }
     
     // Performance monitoring
     struct PerformanceStats {
@@ -198,44 +314,205 @@ private:
     ParserResult parse_chunk(
         const MemoryMappedFile& file,
         const ParallelProcessor::FileChunk& chunk,
-        std::vector<std::unique_ptr<CoverageGroup>>& groups
+        CoverageDatabase& db,
+        PoolVector<RecordPtr<CoverageGroup>>& groups,
+        std::size_t& lines_processed
     );
     
     ParserResult parse_group_line_optimized(
         std::string_view line,
-        std::unique_ptr<CoverageGroup>& group
+        CoverageDatabase& db,
+        RecordPtr<CoverageGroup>& group
     );
-    
-    // Fast tokenization using SIMD
-    std::vector<std::string_view> tokenize_line_simd(std::string_view line);
 };
 
 /**
  * @brief High-performance hierarchy parser
  * Optimized for processing large hierarchy.txt files
+ * 
+ * Uses the same pipeline as HighPerformanceGroupsParser: the file is memory
+ * mapped, split into line-aligned chunks, each chunk is parsed on its own
+ * thread into a private result vector, and each worker stages its vector in
+ * the database's sharded ingest (CoverageDatabase::begin_ingest()). With
+ * ParserConfig::max_instances set, the vectors are instead merged in file
+ * order on the calling thread, which is the only place the cap can be counted.
+ * 
+ * LINE GRAMMAR (data section, after the "SCORE ASSERT" header):
+ *   <score> <assert score> <covered>/<expected> <instance path>
+ *   "  0.00    0.00 0/66   dcec_dc.dchubbubl.udchubbubl.mem_0_0.PDP"
  */
-class HighPerformanceHierarchyParser {
+class HighPerformanceHierarchyParser : public HierarchyParser {
 public:
-    ParserResult parse(const std::string& filename, CoverageDatabase& db);
-    const PerformanceGroupsParser::PerformanceStats& get_stats() const { return stats_; }
+    HighPerformanceHierarchyParser();
+    ~HighPerformanceHierarchyParser() override = default;
+    
+    /**
+     * @brief Parse hierarchy file with maximum performance
+     */
+    ParserResult parse(const std::string& filename, CoverageDatabase& db) override;
+    std::string get_parser_info() const override { return "High-Performance Hierarchy Parser v2.0"; }
+    
+    const HighPerformanceGroupsParser::PerformanceStats& get_stats() const { return stats_; }
     
 private:
     MemoryPool memory_pool_;
     HighPerformanceGroupsParser::PerformanceStats stats_;
+    
+    // Chunk processing functions
+    ParserResult parse_chunk(
+        const MemoryMappedFile& file,
+        const ParallelProcessor::FileChunk& chunk,
+        CoverageDatabase& db,
+        PoolVector<RecordPtr<HierarchyInstance>>& instances,
+        std::size_t& lines_processed,
+        std::atomic<std::uint32_t>& parse_errors
+    );
+    
+    ParserResult parse_hierarchy_line_optimized(
+        std::string_view line,
+        CoverageDatabase& db,
+        RecordPtr<HierarchyInstance>& instance
+    );
+    
+    // Offset of the first byte after the "SCORE ASSERT" column header, npos if absent
+    static std::size_t find_data_section(const MemoryMappedFile& file);
 };
 
 /**
  * @brief High-performance assert parser
  * Optimized for processing huge asserts.txt files (100MB+)
+ * 
+ * AssertParser accepts three line layouts and decides between them on every
+ * line. Report files never mix layouts, so this parser inspects the first
+ * data line once, then runs a zero-copy tokenizer specialized for that layout
+ * over all chunks in parallel:
+ * 
+ *   STATUS_HITS:       PASS 1234 check_valid_transaction tb.cpu.alu alu.sv:45
+ *   COVERAGE_FRACTION: 3/4 check_valid_transaction tb.cpu.alu
+ *   NAME_PATH_STATUS:  check_valid_transaction tb.cpu.alu COVERED
  */
-class HighPerformanceAssertParser {
+class HighPerformanceAssertParser : public AssertParser {
 public:
-    ParserResult parse(const std::string& filename, CoverageDatabase& db);
+    enum class LineLayout {
+        STATUS_HITS,         /**< STATUS HITS NAME PATH FILE:LINE */
+        COVERAGE_FRACTION,   /**< COVERED/EXPECTED NAME PATH */
+        NAME_PATH_STATUS     /**< NAME PATH STATUS */
+    };
+    
+    HighPerformanceAssertParser();
+    ~HighPerformanceAssertParser() override = default;
+    
+    /**
+     * @brief Parse assertion file with maximum performance
+     * Target: 113MB asserts.txt in ~5 seconds
+     */
+    ParserResult parse(const std::string& filename, CoverageDatabase& db) override;
+    std::string get_parser_info() const override { return "High-Performance Assert Parser v2.0"; }
+    
     const HighPerformanceGroupsParser::PerformanceStats& get_stats() const { return stats_; }
     
+    /// Layout detected during the last parse() call
+    LineLayout get_detected_layout() const { return layout_; }
+    
 private:
     MemoryPool memory_pool_;
     HighPerformanceGroupsParser::PerformanceStats stats_;
+    LineLayout layout_ = LineLayout::STATUS_HITS;
+    
+    // Chunk processing functions
+    ParserResult parse_chunk(
+        const MemoryMappedFile& file,
+        const ParallelProcessor::FileChunk& chunk,
+        CoverageDatabase& db,
+        PoolVector<RecordPtr<AssertCoverage>>& asserts,
+        std::size_t& lines_processed,
+        std::atomic<std::uint32_t>& parse_errors
+    ) const;
+    
+    // Layout-specialized line parsers
+    static ParserResult parse_status_hits_line(std::string_view line, CoverageDatabase& db, AssertCoverage& assert_cov);
+    static ParserResult parse_coverage_fraction_line(std::string_view line, CoverageDatabase& db, AssertCoverage& assert_cov);
+    static ParserResult parse_name_path_status_line(std::string_view line, CoverageDatabase& db, AssertCoverage& assert_cov);
+    
+    // Locate the data section and detect its layout from the first data line
+    static std::size_t find_data_section(const MemoryMappedFile& file);
+    static bool detect_layout(const MemoryMappedFile& file, std::size_t data_offset, LineLayout& layout);
+    static bool is_header_text(std::string_view line);
+};
+
+/**
+ * @brief High-performance module list parser
+ * Optimized for processing large modlist.txt files
+ * 
+ * Module lines share the hierarchy line grammar, so this parser uses the same
+ * memory-mapped, chunked pipeline as HighPerformanceHierarchyParser:
+ *   <score> <assert score> <covered>/<expected> <module name>
+ *   "  0.00    0.00 0/4      hvm_ffbm_tlb_mem1p32768x24bls"
+ */
+class HighPerformanceModuleListParser : public ModuleListParser {
+public:
+    HighPerformanceModuleListParser();
+    ~HighPerformanceModuleListParser() override = default;
+    
+    /**
+     * @brief Parse module list file with maximum performance
+     */
+    ParserResult parse(const std::string& filename, CoverageDatabase& db) override;
+    std::string get_parser_info() const override { return "High-Performance Module List Parser v2.0"; }
+    
+    const HighPerformanceGroupsParser::PerformanceStats& get_stats() const { return stats_; }
+    
+private:
+    MemoryPool memory_pool_;
+    HighPerformanceGroupsParser::PerformanceStats stats_;
+    
+    // Chunk processing functions
+    ParserResult parse_chunk(
+        const MemoryMappedFile& file,
+        const ParallelProcessor::FileChunk& chunk,
+        CoverageDatabase& db,
+        PoolVector<RecordPtr<ModuleDefinition>>& modules,
+        std::size_t& lines_processed,
+        std::atomic<std::uint32_t>& parse_errors
+    );
+    
+    ParserResult parse_module_line_optimized(
+        std::string_view line,
+        CoverageDatabase& db,
+        RecordPtr<ModuleDefinition>& module
+    ) const;
+    
+    // Offset of the first byte after the "SCORE ASSERT NAME" column header, npos if absent
+    static std::size_t find_data_section(const MemoryMappedFile& file);
+};
+
+/**
+ * @brief High-performance dashboard parser
+ * 
+ * dashboard.txt is small, so there is nothing to gain from threads; the win
+ * over DashboardParser is a single forward pass over the memory-mapped file
+ * instead of three ifstream scans. Statistics
+ * are reported like the other high-performance parsers, with groups_parsed
+ * holding the number of hierarchical instances counted.
+ */
+class HighPerformanceDashboardParser : public DashboardParser {
+public:
+    HighPerformanceDashboardParser() = default;
+    ~HighPerformanceDashboardParser() override = default;
+    
+    /**
+     * @brief Parse dashboard file with a single pass over the mapping
+     */
+    ParserResult parse(const std::string& filename, CoverageDatabase& db) override;
+    std::string get_parser_info() const override { return "High-Performance Dashboard Parser v2.0"; }
+    
+    const HighPerformanceGroupsParser::PerformanceStats& get_stats() const { return stats_; }
+    
+private:
+    HighPerformanceGroupsParser::PerformanceStats stats_;
+    
+    static void parse_metadata_line(std::string_view line, DashboardData& dashboard);
+    static ParserResult parse_summary_line(std::string_view line, DashboardData& dashboard);
 };
 
 /**
@@ -250,6 +527,7 @@ public:
     static std::unique_ptr<GroupsParser> create_groups_parser(const std::string& filename);
     static std::unique_ptr<HierarchyParser> create_hierarchy_parser(const std::string& filename);
     static std::unique_ptr<AssertParser> create_assert_parser(const std::string& filename);
+    static std::unique_ptr<ModuleListParser> create_modlist_parser(const std::string& filename);
     
 private:
     static constexpr std::size_t OPTIMIZATION_THRESHOLD = 10 * 1024 * 1024; // 10MB
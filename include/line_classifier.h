@@ -0,0 +1,73 @@
+/**
+ * @file line_classifier.h
+ * @brief Regex-free data line classification shared by all coverage parsers
+ *
+ * Each parser used to decide whether a line holds data by building a
+ * std::regex and calling std::regex_match on every line. These hand-written
+ * scanners accept exactly the same line shapes in a single left-to-right pass
+ * with no allocation.
+ *
+ * Character classes follow std::regex (ECMAScript, "C" locale):
+ * - \s : ' ', '\t', '\n', '\v', '\f', '\r'
+ * - \d : '0'-'9'
+ * - \w : ASCII letters, digits and '_'
+ * - .  : any character except '\n' and '\r'
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#ifndef LINE_CLASSIFIER_H
+#define LINE_CLASSIFIER_H
+
+#include <string_view>
+
+namespace coverage_parser {
+namespace line_classifier {
+
+/**
+ * @brief Groups data line: \s*\d+\s+\d+\s+[\d\-\.]+.*
+ *
+ * Example: "  45.2   89  2  1  120  tb.cpu.alu::arithmetic_ops"
+ */
+bool is_group_data_line(std::string_view line) noexcept;
+
+/**
+ * @brief Hierarchy data line: \s*\d+\.\d+\s+\d+\.\d+\s+\d+/\d+\s+.+
+ *
+ * Example: "  0.00    0.00 0/66   dcec_dc.dchubbubl.mem_0_0.PDP"
+ */
+bool is_hierarchy_data_line(std::string_view line) noexcept;
+
+/**
+ * @brief Module list data line, same shape as a hierarchy data line
+ *
+ * Example: "  0.00    0.00 0/4      hvm_ffbm_tlb_mem1p32768x24bls"
+ */
+bool is_module_data_line(std::string_view line) noexcept;
+
+/**
+ * @brief Dashboard instance line: \s*\d+\.\d+\s+\d+\.\d+\s+\d+/\d+.*\w+
+ */
+bool is_dashboard_instance_line(std::string_view line) noexcept;
+
+/**
+ * @brief Assert "STATUS HITS ..." line: \s*(PASS|FAIL|COVERED|UNCOVERED)\s+\d+\s+.+
+ */
+bool is_assert_status_line(std::string_view line) noexcept;
+
+/**
+ * @brief Assert "covered/expected ..." line: \s*\d+/\d+\s+.+
+ */
+bool is_assert_fraction_line(std::string_view line) noexcept;
+
+/**
+ * @brief Free-form assert line: \s*\w+.*\w+.*\w+.*
+ */
+bool is_assert_general_line(std::string_view line) noexcept;
+
+} // namespace line_classifier
+} // namespace coverage_parser
+
+#endif /* LINE_CLASSIFIER_H */
@@ -0,0 +1,178 @@
+/**
+ * @file line_tokenizer.h
+ * @brief Zero-copy whitespace tokenizer shared by all coverage parsers
+ *
+ * Report lines are split into std::string_view fields that point straight
+ * into the caller's line buffer (a std::string from getline or a memory-mapped
+ * file). Fields are collected in a caller-owned, fixed-capacity FieldBuffer,
+ * so tokenizing a line never allocates.
+ *
+ * Most report formats end with a free-form name that may contain spaces
+ * ("rest of line is the name"). split_with_tail() handles that by returning
+ * a fixed number of leading fields followed by the remainder of the line,
+ * trimmed of surrounding whitespace, as a single field.
+ *
+ * USAGE EXAMPLE:
+ * ```cpp
+ * tokenizer::FieldBuffer<4> fields;
+ * tokenizer::split_with_tail("  0.00  0.00 0/66   tb.u_core.mem_0_0 ", 3, fields);
+ * // fields[0] == "0.00", fields[2] == "0/66", fields[3] == "tb.u_core.mem_0_0"
+ * ```
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#ifndef LINE_TOKENIZER_H
+#define LINE_TOKENIZER_H
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+namespace coverage_parser {
+namespace tokenizer {
+
+/**
+ * @brief Fixed-capacity list of string_view fields
+ *
+ * Lives on the caller's stack; the views are only valid while the tokenized
+ * line is alive.
+ */
+template <std::size_t Capacity>
+class FieldBuffer {
+public:
+    static constexpr std::size_t capacity() noexcept { return Capacity; }
+
+    std::size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    bool full() const noexcept { return size_ == Capacity; }
+    void clear() noexcept { size_ = 0; }
+
+    /**
+     * @brief Append a field
+     * @return false if the buffer is already full
+     */
+    bool push_back(std::string_view field) noexcept {
+        if (size_ == Capacity) {
+            return false;
+        }
+        fields_[size_++] = field;
+        return true;
+    }
+
+    std::string_view operator[](std::size_t index) const noexcept { return fields_[index]; }
+
+    const std::string_view* begin() const noexcept { return fields_.data(); }
+    const std::string_view* end() const noexcept { return fields_.data() + size_; }
+
+private:
+    std::array<std::string_view, Capacity> fields_{};
+    std::size_t size_ = 0;
+};
+
+/**
+ * @brief Field separator test, matching operator>> in the "C" locale
+ */
+constexpr bool is_space(char c) noexcept {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+/**
+ * @brief Remove leading and trailing whitespace from a view
+ */
+inline std::string_view trim(std::string_view text) noexcept {
+    std::size_t begin = 0;
+    std::size_t end = text.size();
+    while (begin < end && is_space(text[begin])) {
+        ++begin;
+    }
+    while (end > begin && is_space(text[end - 1])) {
+        --end;
+    }
+    return text.substr(begin, end - begin);
+}
+
+/**
+ * @brief Extract the next whitespace-delimited field
+ * @param line Line being tokenized
+ * @param pos Scan position, advanced past the returned field
+ * @return The field, or an empty view when the line is exhausted
+ */
+inline std::string_view next_field(std::string_view line, std::size_t& pos) noexcept {
+    while (pos < line.size() && is_space(line[pos])) {
+        ++pos;
+    }
+    std::size_t begin = pos;
+    while (pos < line.size() && !is_space(line[pos])) {
+        ++pos;
+    }
+    return line.substr(begin, pos - begin);
+}
+
+/**
+ * @brief Invoke a callback for every whitespace-delimited field
+ */
+template <typename Callback>
+void for_each_field(std::string_view line, Callback&& callback) {
+    std::size_t pos = 0;
+    for (std::string_view field = next_field(line, pos); !field.empty(); field = next_field(line, pos)) {
+        callback(field);
+    }
+}
+
+/**
+ * @brief Split a line on whitespace
+ *
+ * Fields beyond the buffer capacity are not stored.
+ *
+ * @return true if every field of the line fit into the buffer
+ */
+template <std::size_t Capacity>
+bool split_fields(std::string_view line, FieldBuffer<Capacity>& fields) noexcept {
+    fields.clear();
+    std::size_t pos = 0;
+    for (std::string_view field = next_field(line, pos); !field.empty(); field = next_field(line, pos)) {
+        if (!fields.push_back(field)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Split leading fields and keep the rest of the line as one field
+ *
+ * The first @p leading whitespace-delimited fields are stored individually;
+ * whatever follows them, with surrounding whitespace trimmed, becomes one
+ * final field. No tail field is stored when the remainder is blank, so a
+ * complete line yields leading + 1 fields and a short line yields fewer.
+ *
+ * @param line Line to split
+ * @param leading Number of individual fields before the tail (< Capacity)
+ * @param fields Output buffer
+ */
+template <std::size_t Capacity>
+void split_with_tail(std::string_view line, std::size_t leading, FieldBuffer<Capacity>& fields) noexcept {
+    static_assert(Capacity > 0, "FieldBuffer needs room for the tail field");
+    fields.clear();
+    std::size_t pos = 0;
+    for (std::size_t i = 0; i < leading && i + 1 < Capacity; ++i) {
+        std::string_view field = next_field(line, pos);
+        if (field.empty()) {
+            return;
+        }
+        fields.push_back(field);
+    }
+
+    std::string_view tail = trim(line.substr(pos));
+    if (!tail.empty()) {
+        fields.push_back(tail);
+    }
+}
+
+} // namespace tokenizer
+} // namespace coverage_parser
+
+#endif /* LINE_TOKENIZER_H */
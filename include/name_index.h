@@ -0,0 +1,159 @@
+/**
+ * @file name_index.h
+ * @brief Sorted-name index answering prefix and scope queries
+ *
+ * Hierarchical names that share a prefix sort next to each other, so once a
+ * table's keys are sorted, every name starting with "tb.cpu" lies in one
+ * contiguous run found by two binary searches. A query costs O(log n) plus
+ * the size of its result, instead of a scan of the whole table.
+ *
+ * A scope query returns the scope itself and its descendants under either
+ * hierarchy delimiter: "tb.cpu" matches "tb.cpu", "tb.cpu.alu" and
+ * "tb.cpu::cg", but not "tb.cpu2". Each delimiter's descendants form their
+ * own run, so no entry outside the result is visited.
+ *
+ * USAGE EXAMPLE:
+ * ```cpp
+ * const NameIndex<CoverageGroup>& groups = db.group_index();
+ * for (const auto& entry : groups.find_prefix("tb.cpu")) {
+ *     std::cout << entry.name << std::endl;
+ * }
+ * groups.for_each_in_scope("tb.cpu.alu", [](std::string_view name, CoverageGroup* group) {
+ *     std::cout << name << ": " << group->coverage.score << std::endl;
+ * });
+ * ```
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#ifndef NAME_INDEX_H
+#define NAME_INDEX_H
+
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace coverage_parser {
+
+/**
+ * @brief Name-sorted (name, record) pairs of one database table
+ *
+ * Names are views of the table keys; the index is only valid while the
+ * table it was built from is unchanged.
+ */
+template <typename T>
+class NameIndex {
+public:
+    struct Entry {
+        std::string_view name;
+        T* record;
+    };
+
+    /**
+     * @brief Contiguous run of entries, usable in range-based for loops
+     */
+    class Range {
+    public:
+        Range(const Entry* first, const Entry* last) : first_(first), last_(last) {}
+        const Entry* begin() const { return first_; }
+        const Entry* end() const { return last_; }
+        std::size_t size() const { return static_cast<std::size_t>(last_ - first_); }
+        bool empty() const { return first_ == last_; }
+
+    private:
+        const Entry* first_;
+        const Entry* last_;
+    };
+
+    /**
+     * @brief Rebuild from a table mapping names to owning record pointers
+     */
+    template <typename Table>
+    void assign(const Table& table) {
+        entries_.clear();
+        entries_.reserve(table.size());
+        for (const auto& [name, record] : table) {
+            if (record) {
+                entries_.push_back(Entry{name, record.get()});
+            }
+        }
+        std::sort(entries_.begin(), entries_.end(),
+                  [](const Entry& lhs, const Entry& rhs) { return lhs.name < rhs.name; });
+    }
+
+    void clear() { entries_.clear(); }
+    std::size_t size() const { return entries_.size(); }
+    bool empty() const { return entries_.empty(); }
+
+    // All entries, in name order
+    Range all() const { return Range(entries_.data(), entries_.data() + entries_.size()); }
+
+    /**
+     * @brief Entries whose name starts with @p prefix
+     */
+    Range find_prefix(std::string_view prefix) const { return prefix_run(prefix, std::string_view()); }
+
+    /**
+     * @brief The entry named exactly @p name, or nullptr
+     */
+    T* find(std::string_view name) const {
+        Range run = prefix_run(name, std::string_view());
+        return (!run.empty() && run.begin()->name == name) ? run.begin()->record : nullptr;
+    }
+
+    /**
+     * @brief Visit @p scope and every name below it ("." or "::" delimited)
+     *
+     * Visits the scope first, then its "." descendants, then its "::"
+     * descendants, each run in name order.
+     */
+    template <typename Visitor>
+    void for_each_in_scope(std::string_view scope, Visitor&& visit) const {
+        if (T* record = find(scope)) {
+            visit(scope, record);
+        }
+        for (std::string_view delimiter : {std::string_view("."), std::string_view("::")}) {
+            for (const Entry& entry : prefix_run(scope, delimiter)) {
+                visit(entry.name, entry.record);
+            }
+        }
+    }
+
+    /**
+     * @brief Records of @p scope and every name below it
+     */
+    std::vector<T*> find_in_scope(std::string_view scope) const {
+        std::vector<T*> records;
+        for_each_in_scope(scope, [&records](std::string_view, T* record) { records.push_back(record); });
+        return records;
+    }
+
+private:
+    std::vector<Entry> entries_;
+
+    // Order of `name` relative to names starting with head + tail, without
+    // concatenating: negative before the run, 0 inside it, positive after it
+    static int compare_with_prefix(std::string_view name, std::string_view head, std::string_view tail) {
+        int order = name.substr(0, head.size()).compare(head);
+        if (order != 0) {
+            return order;
+        }
+        return name.substr(head.size(), tail.size()).compare(tail);
+    }
+
+    // Run of entries starting with head + tail: two binary searches
+    Range prefix_run(std::string_view head, std::string_view tail) const {
+        const Entry* first = std::partition_point(entries_.data(), entries_.data() + entries_.size(),
+            [&](const Entry& entry) { return compare_with_prefix(entry.name, head, tail) < 0; });
+        const Entry* last = std::partition_point(first, entries_.data() + entries_.size(),
+            [&](const Entry& entry) { return compare_with_prefix(entry.name, head, tail) == 0; });
+        return Range(first, last);
+    }
+};
+
+} // namespace coverage_parser
+
+#endif /* NAME_INDEX_H */
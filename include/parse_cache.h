@@ -0,0 +1,122 @@
+/**
+ * @file parse_cache.h
+ * @brief Opt-in cache of parsed reports, keyed by file identity and content
+ *
+ * The same coverage reports are parsed again by every tool that reads
+ * them. A ParseCache keeps, in a local directory, the snapshot (see
+ * coverage_snapshot.h) of each report's parse result. When a report is
+ * parsed again unchanged, the snapshot is loaded instead: reading fixed-size
+ * records costs a fraction of tokenizing text. Loading still creates one
+ * record per stored record; open() maps the snapshot for lookups instead.
+ *
+ * An entry is keyed by the report's size, its last write time and a hash of
+ * sampled blocks of its content (the whole file below 1 MiB; otherwise 16
+ * evenly spread 64 KiB blocks, including the first and last). Size and time
+ * catch ordinary rewrites; the content hash catches a report replaced by
+ * one of the same size with its time preserved (copies, checkouts). The
+ * key also includes a caller-chosen variant naming the parser and its
+ * settings, since different parsers make different databases of one file.
+ *
+ * Entries are written to a temporary file and renamed into place, so
+ * concurrent processes sharing a directory never see a partial entry.
+ * Entries are never evicted; remove the directory's files to reclaim space.
+ *
+ * USAGE EXAMPLE:
+ * ```cpp
+ * ParseCache cache("/tmp/coverage-cache");
+ * HighPerformanceGroupsParser parser;
+ * ParserResult result = cache.parse("groups.txt", "groups", db,
+ *     [&parser](const std::string& file, CoverageDatabase& target) { return parser.parse(file, target); });
+ * ```
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#ifndef PARSE_CACHE_H
+#define PARSE_CACHE_H
+
+#include "functional_coverage_parser.h"
+#include "coverage_snapshot.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace coverage_parser {
+
+/**
+ * @brief Identity of one report file's contents
+ */
+struct ParseCacheKey {
+    std::uint64_t file_size;
+    std::int64_t  modified_ns;     /**< Last write time, in the file clock's epoch */
+    std::uint64_t content_hash;    /**< snapshot::checksum() of sampled blocks */
+};
+
+/**
+ * @brief Directory of report snapshots that parse() consults before parsing
+ *
+ * parse() may be called from several threads at once, for the same or for
+ * different reports.
+ */
+class COVERAGE_PARSER_API ParseCache {
+public:
+    using ParseFunction = std::function<ParserResult(const std::string& filename, CoverageDatabase& db)>;
+
+    /**
+     * @param directory Where entries are kept; created on first store
+     */
+    explicit ParseCache(std::string directory);
+
+    const std::string& directory() const { return directory_; }
+
+    /**
+     * @brief Compute the key of @p filename
+     * @return false if the file cannot be read
+     */
+    static bool compute_key(const std::string& filename, ParseCacheKey& key);
+
+    /**
+     * @brief Path of the entry for @p key made by parser @p variant
+     */
+    std::string entry_path(const ParseCacheKey& key, std::string_view variant) const;
+
+    /**
+     * @brief Add the parse result of @p filename to @p db, from the cache if possible
+     *
+     * On a hit, merges the cached snapshot into @p db. On a miss, runs
+     * @p parse_file and stores what it added; into a scratch database of the
+     * same storage mode first if @p db already holds records, so that the
+     * entry holds only this report. Failed parses are not cached, and
+     * failing to store an entry does not fail the parse.
+     */
+    ParserResult parse(const std::string& filename, std::string_view variant, CoverageDatabase& db,
+                       const ParseFunction& parse_file);
+
+    /**
+     * @brief Map the cached snapshot of @p filename into @p reader, parsing on a miss
+     *
+     * The read-only counterpart of parse(), for callers that only look
+     * records up: a hit verifies the entry's checksums and maps it, without
+     * creating a record per stored record. On a miss, runs @p parse_file into
+     * a scratch database and maps the entry it stores; if the entry cannot be
+     * stored there is nothing to map, and the store's error is returned.
+     */
+    ParserResult open(const std::string& filename, std::string_view variant, SnapshotReader& reader,
+                      const ParseFunction& parse_file);
+
+    std::uint64_t hits() const { return hits_.load(std::memory_order_relaxed); }
+    std::uint64_t misses() const { return misses_.load(std::memory_order_relaxed); }
+
+private:
+    std::string                 directory_;
+    std::atomic<std::uint64_t>  hits_{0};
+    std::atomic<std::uint64_t>  misses_{0};
+};
+
+} // namespace coverage_parser
+
+#endif /* PARSE_CACHE_H */
@@ -0,0 +1,210 @@
+/**
+ * @file record_stream.h
+ * @brief Streaming access to report records without a CoverageDatabase
+ *
+ * Parsing into a CoverageDatabase keeps every record of a report in memory.
+ * One-pass jobs ("count uncovered asserts per file") need each record only
+ * once. A RecordReader reads a report line by line and yields one record at
+ * a time, so memory use is fixed: the input buffer plus the longest line,
+ * whatever the report's size.
+ *
+ * Records are views: their strings point into the reader's current line
+ * and stay valid only until the next call to next(). Copy what must be kept.
+ *
+ * The same rules decide which lines are records, how they are decoded and
+ * which ParserConfig filters apply as when parsing into a database; the
+ * standard parsers are built on RecordReader.
+ *
+ * USAGE EXAMPLE:
+ * ```cpp
+ * // Pull records
+ * RecordReader reader("asserts.txt", ReportKind::ASSERTS);
+ * std::map<std::string, std::uint32_t, std::less<>> uncovered_per_file;
+ * while (reader.next()) {
+ *     const AssertRecord& record = reader.assert_record();
+ *     if (!record.is_covered) {
+ *         ++uncovered_per_file[std::string(record.file_location)];
+ *     }
+ * }
+ * ParserResult result = reader.status();
+ *
+ * // Or have a parser push them to a visitor
+ * struct UncoveredGroups : RecordVisitor {
+ *     std::uint32_t count = 0;
+ *     bool on_group(const GroupRecord& group) override {
+ *         count += group.coverage.covered == 0;
+ *         return true;
+ *     }
+ * } visitor;
+ * GroupsParser parser;
+ * result = parser.stream("groups.txt", visitor);
+ * ```
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#ifndef RECORD_STREAM_H
+#define RECORD_STREAM_H
+
+#include "functional_coverage_parser.h"
+#include "compressed_input.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace coverage_parser {
+
+/**
+ * @brief Report formats that hold one record per line
+ */
+enum class ReportKind {
+    GROUPS,     /**< groups.txt, yields GroupRecord */
+    HIERARCHY,  /**< hierarchy.txt, yields HierarchyRecord */
+    MODULES,    /**< modlist.txt, yields ModuleRecord */
+    ASSERTS     /**< asserts.txt, yields AssertRecord */
+};
+
+/**
+ * @brief Transient view of a CoverageGroup
+ */
+struct GroupRecord {
+    std::string_view name;
+    CoverageMetrics  coverage;
+    CoverageMetrics  instance_coverage;
+    std::uint32_t    instances{0};
+    std::uint32_t    weight{1};
+    std::uint32_t    goal{100};
+    std::uint32_t    at_least{1};
+    std::uint32_t    per_instance{0};
+    std::uint32_t    auto_bin_max{64};
+    std::uint32_t    print_missing{64};
+    bool             is_auto_generated{false};
+};
+
+/**
+ * @brief Transient view of a HierarchyInstance
+ */
+struct HierarchyRecord {
+    std::string_view instance_path;
+    std::string_view module_name;       /**< Last component of instance_path */
+    double           total_score{0.0};
+    CoverageMetrics  assert_coverage;
+    std::uint32_t    depth_level{0};
+    bool             is_leaf_instance{false};
+};
+
+/**
+ * @brief Transient view of a ModuleDefinition
+ */
+struct ModuleRecord {
+    std::string_view module_name;
+    double           total_score{0.0};
+    CoverageMetrics  assert_coverage;
+    std::uint32_t    instance_count{0};
+    std::uint32_t    covered_instances{0};
+};
+
+/**
+ * @brief Transient view of an AssertCoverage
+ */
+struct AssertRecord {
+    std::string_view assert_name;
+    std::string_view instance_path;
+    std::string_view file_location;
+    std::string_view severity;
+    std::uint32_t    line_number{0};
+    bool             is_covered{false};
+    std::uint32_t    hit_count{0};
+};
+
+/**
+ * @brief Receives the records of a streamed report
+ *
+ * Each callback returns true to continue or false to stop the stream
+ * early; stopping is not an error. Only the callback matching the report
+ * kind is called.
+ */
+class COVERAGE_PARSER_API RecordVisitor {
+public:
+    virtual ~RecordVisitor() = default;
+
+    virtual bool on_group(const GroupRecord& record) { (void)record; return true; }
+    virtual bool on_instance(const HierarchyRecord& record) { (void)record; return true; }
+    virtual bool on_module(const ModuleRecord& record) { (void)record; return true; }
+    virtual bool on_assert(const AssertRecord& record) { (void)record; return true; }
+};
+
+/**
+ * @brief Pull reader over the records of one report
+ *
+ * The constructor opens the report (plain or compressed, see
+ * compressed_input.h) and reads its header; each next() then reads lines
+ * up to the next record. When next() returns false, status() tells whether
+ * the report ended normally or was rejected (unknown format, too many
+ * malformed lines, corrupt compressed data).
+ */
+class COVERAGE_PARSER_API RecordReader {
+public:
+    RecordReader(const std::string& filename, ReportKind kind, const ParserConfig& config = ParserConfig());
+
+    RecordReader(const RecordReader&) = delete;
+    RecordReader& operator=(const RecordReader&) = delete;
+
+    /**
+     * @brief Advance to the next record
+     * @return false at the end of the report or on error
+     */
+    bool next();
+
+    ParserResult status() const { return status_; }
+    ReportKind kind() const { return kind_; }
+
+    /**
+     * @brief Record count the report header declares, 0 if it has none
+     */
+    std::uint32_t declared_total() const { return declared_total_; }
+
+    /**
+     * @brief Current record; only the accessor matching kind() is meaningful
+     */
+    const GroupRecord& group() const { return group_; }
+    const HierarchyRecord& instance() const { return instance_; }
+    const ModuleRecord& module() const { return module_; }
+    const AssertRecord& assert_record() const { return assert_; }
+
+private:
+    bool read_header();
+    ParserResult decode_line(std::string_view line, bool& accepted);
+    ParserResult decode_group(std::string_view line, bool& accepted);
+    ParserResult decode_instance(std::string_view line, bool& accepted);
+    ParserResult decode_module(std::string_view line, bool& accepted);
+    ParserResult decode_assert(std::string_view line);
+
+    ReportStream     file_;
+    ReportKind       kind_;
+    ParserConfig     config_;
+    ParserResult     status_{ParserResult::SUCCESS};
+    bool             finished_{false};
+    std::string      line_;
+    std::uint32_t    declared_total_{0};
+    std::uint32_t    records_read_{0};   /**< Decoded records, counted against the config limits */
+    std::uint32_t    parse_errors_{0};
+
+    GroupRecord      group_;
+    HierarchyRecord  instance_;
+    ModuleRecord     module_;
+    AssertRecord     assert_;
+};
+
+/**
+ * @brief Read @p filename and pass each record to @p visitor
+ * @return SUCCESS if the report was read to the end or the visitor stopped it
+ */
+COVERAGE_PARSER_API ParserResult stream_report(const std::string& filename, ReportKind kind, RecordVisitor& visitor,
+                                               const ParserConfig& config = ParserConfig());
+
+} // namespace coverage_parser
+
+#endif /* RECORD_STREAM_H */
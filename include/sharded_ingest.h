@@ -0,0 +1,170 @@
+/**
+ * @file sharded_ingest.h
+ * @brief Hash-partitioned staging table that many threads insert into at once
+ *
+ * Parallel parsers used to hand every record back to the calling thread,
+ * which then inserted them one by one: the merge ran on one core however
+ * many parsed. A ShardedIngest splits the key space into independently
+ * locked shards by hash, so workers insert their own results while other
+ * workers keep parsing. A worker buckets its batch by shard first and takes
+ * each shard's lock once per batch, not once per record.
+ *
+ * Each record carries an order (batch, position in batch). When a key is
+ * inserted twice, the higher order wins regardless of which thread got
+ * there first, so the outcome matches inserting the batches serially in
+ * batch order.
+ *
+ * USAGE EXAMPLE:
+ * ```cpp
+ * ShardedIngest<RecordPtr<CoverageGroup>> staging(64);
+ * // On each worker, for its chunk `index`:
+ * staging.insert(index, keys.data(), groups.data(), groups.size());
+ * // Once every worker is done:
+ * staging.drain([&](std::string_view key, RecordPtr<CoverageGroup>&& group, std::uint64_t) {
+ *     table[key] = std::move(group);
+ * });
+ * ```
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#ifndef SHARDED_INGEST_H
+#define SHARDED_INGEST_H
+
+#include "flat_hash_map.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace coverage_parser {
+
+/**
+ * @brief Concurrent insert-only map from keys to owned values, split into shards
+ *
+ * Keys are views and must outlive the ingest (the database passes interned
+ * names). insert() may be called from any number of threads; drain(),
+ * size() and reserve() must not run concurrently with insert().
+ */
+template <typename Value>
+class ShardedIngest {
+public:
+    /**
+     * @param shards Number of shards, rounded up to a power of two
+     */
+    explicit ShardedIngest(std::size_t shards) {
+        while ((std::size_t{1} << shard_bits_) < shards) {
+            ++shard_bits_;
+        }
+        shards_ = std::make_unique<Shard[]>(shard_count());
+    }
+
+    std::size_t shard_count() const { return std::size_t{1} << shard_bits_; }
+
+    /**
+     * @brief Insert one batch of records; entries with an empty key are skipped
+     * @param batch Batch number: later batches win over earlier ones
+     */
+    void insert(std::uint32_t batch, const std::string_view* keys, Value* values, std::size_t count) {
+        // Counting sort of the batch by shard
+        std::vector<std::uint32_t> shard_of(count);
+        std::vector<std::size_t> starts(shard_count() + 1, 0);
+        for (std::size_t i = 0; i < count; ++i) {
+            shard_of[i] = static_cast<std::uint32_t>(shard_index(keys[i]));
+            ++starts[shard_of[i] + 1];
+        }
+        for (std::size_t shard = 0; shard < shard_count(); ++shard) {
+            starts[shard + 1] += starts[shard];
+        }
+        std::vector<std::uint32_t> by_shard(count);
+        std::vector<std::size_t> cursor(starts.begin(), starts.end() - 1);
+        for (std::size_t i = 0; i < count; ++i) {
+            by_shard[cursor[shard_of[i]]++] = static_cast<std::uint32_t>(i);
+        }
+
+        for (std::size_t shard = 0; shard < shard_count(); ++shard) {
+            if (starts[shard] == starts[shard + 1]) {
+                continue;
+            }
+            Shard& target = shards_[shard];
+            std::lock_guard<std::mutex> lock(target.mutex);
+            for (std::size_t k = starts[shard]; k < starts[shard + 1]; ++k) {
+                const std::uint32_t i = by_shard[k];
+                if (keys[i].empty()) {
+                    continue;
+                }
+                const std::uint64_t order = (static_cast<std::uint64_t>(batch) << 32) | i;
+                auto [it, inserted] = target.slots.try_emplace(keys[i]);
+                if (inserted || order > it->second.order) {
+                    it->second.value = std::move(values[i]);
+                    it->second.order = order;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Pre-size every shard for @p entries spread evenly
+     */
+    void reserve(std::size_t entries) {
+        for (std::size_t shard = 0; shard < shard_count(); ++shard) {
+            shards_[shard].slots.reserve(entries / shard_count() + 1);
+        }
+    }
+
+    std::size_t size() const {
+        std::size_t total = 0;
+        for (std::size_t shard = 0; shard < shard_count(); ++shard) {
+            total += shards_[shard].slots.size();
+        }
+        return total;
+    }
+
+    /**
+     * @brief Hand every entry to sink(key, Value&&, order), shard by shard, and empty the ingest
+     */
+    template <typename Sink>
+    void drain(Sink&& sink) {
+        for (std::size_t shard = 0; shard < shard_count(); ++shard) {
+            auto& slots = shards_[shard].slots;
+            for (auto& [key, slot] : slots) {
+                sink(key, std::move(slot.value), slot.order);
+            }
+            slots.clear();
+        }
+    }
+
+private:
+    struct Slot {
+        Value value;
+        std::uint64_t order = 0;
+    };
+
+    // Own cache line per shard, so workers locking neighbouring shards do
+    // not contend on the same line
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        FlatHashMap<std::string_view, Slot> slots;
+    };
+
+    std::unique_ptr<Shard[]> shards_;
+    unsigned shard_bits_ = 0;
+
+    // Top hash bits pick the shard; the shard's own table indexes by the low bits
+    std::size_t shard_index(std::string_view key) const {
+        if (shard_bits_ == 0) {
+            return 0;
+        }
+        const std::uint64_t hash = flat_hash_detail::mix_hash(std::hash<std::string_view>{}(key));
+        return static_cast<std::size_t>(hash >> (64 - shard_bits_));
+    }
+};
+
+} // namespace coverage_parser
+
+#endif /* SHARDED_INGEST_H */
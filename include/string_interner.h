@@ -0,0 +1,94 @@
+/**
+ * @file string_interner.h
+ * @brief Database-wide store that keeps one copy of each distinct string
+ *
+ * Coverage reports repeat long hierarchical prefixes and identical values:
+ * every assertion of an instance carries the same instance path, thousands
+ * of assertions share a source file, and every table key duplicates a field
+ * of its record. A StringInterner stores each distinct string once; records
+ * and table keys hold views of the stored copy.
+ *
+ * The store is split into shards selected by hash, each with its own lock,
+ * so the parallel chunk tasks of one parse can intern concurrently.
+ *
+ * USAGE EXAMPLE:
+ * ```cpp
+ * StringInterner strings;
+ * std::string_view a = strings.intern("tb.cpu.alu");
+ * std::string_view b = strings.intern(std::string("tb.cpu.") + "alu");
+ * assert(a.data() == b.data());  // Same stored copy
+ * ```
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#ifndef STRING_INTERNER_H
+#define STRING_INTERNER_H
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+namespace coverage_parser {
+
+/**
+ * @brief Thread-safe string deduplication table
+ *
+ * intern() and find() may be called from any number of threads. clear()
+ * and destruction require that no thread is interning and that no view
+ * handed out is used afterwards.
+ */
+class StringInterner {
+public:
+    StringInterner();
+    ~StringInterner();
+
+    StringInterner(const StringInterner&) = delete;
+    StringInterner& operator=(const StringInterner&) = delete;
+
+    /**
+     * @brief Return the stored copy of @p text, storing it on first use
+     *
+     * The view is NUL-terminated and stays valid until clear(). Equal
+     * strings always yield the same data() pointer.
+     */
+    std::string_view intern(std::string_view text);
+
+    /**
+     * @brief Return the stored copy of @p text without storing it
+     * @return View of the stored copy, or a view with nullptr data if absent
+     */
+    std::string_view find(std::string_view text) const;
+
+    /**
+     * @brief Drop every stored string, keeping memory for reuse
+     */
+    void clear();
+    
+    /**
+     * @brief Size the shards for @p count distinct strings in total
+     * 
+     * Avoids rehashing while a large report is interned. Thread-safe.
+     */
+    void reserve(std::size_t count);
+
+    /**
+     * @brief Exchange contents with @p other (views stay valid)
+     */
+    void swap(StringInterner& other) noexcept { state_.swap(other.state_); }
+
+    // Statistics
+    std::size_t size() const;   /**< Number of distinct strings */
+    std::size_t bytes() const;  /**< Bytes of stored text, including terminators */
+
+private:
+    struct State;  // Shards and text storage, defined in string_interner.cpp
+
+    std::unique_ptr<State> state_;
+};
+
+} // namespace coverage_parser
+
+#endif /* STRING_INTERNER_H */
@@ -0,0 +1,194 @@
+/**
+ * @file thread_pool.h
+ * @brief Library-wide work-stealing thread pool for chunked parsing
+ *
+ * The high-performance parsers split a file into line-aligned chunks and
+ * parse them concurrently. Instead of starting a std::async thread per chunk
+ * on every parse call, they submit chunk tasks to one shared pool, so
+ * parsing many files at once never runs more worker threads than the pool
+ * was sized for.
+ *
+ * Each worker owns a task deque. Tasks submitted from a worker go to its own
+ * deque and are popped LIFO (cache-warm); tasks submitted from other threads
+ * are spread round-robin. Idle workers steal from the front of other deques.
+ *
+ * A thread that waits for a task result through ThreadPool::wait() runs
+ * queued tasks in the meantime, so a parse started from inside a pool task
+ * cannot deadlock the pool.
+ *
+ * USAGE EXAMPLE:
+ * ```cpp
+ * auto pool = ThreadPool::shared();
+ * auto future = pool->submit([] { return parse_some_chunk(); });
+ * auto result = pool->wait(future);
+ * ```
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace coverage_parser {
+namespace performance {
+
+/**
+ * @brief Fixed-size work-stealing thread pool
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief Start the worker threads
+     * @param num_threads Number of workers, 0 for std::thread::hardware_concurrency()
+     */
+    explicit ThreadPool(std::size_t num_threads = 0);
+
+    /**
+     * @brief Run all queued tasks to completion, then join the workers
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Number of worker threads
+     */
+    std::size_t size() const { return threads_.size(); }
+
+    /**
+     * @brief Queue a task
+     * @return Future for the task's result; exceptions are rethrown by get()
+     */
+    template <typename Func>
+    std::future<std::invoke_result_t<std::decay_t<Func>>> submit(Func&& func) {
+        using Result = std::invoke_result_t<std::decay_t<Func>>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Func>(func));
+        std::future<Result> future = task->get_future();
+        enqueue([task]() { (*task)(); });
+        return future;
+    }
+
+    /**
+     * @brief Wait for a submitted task, running queued tasks meanwhile
+     * @return The task's result (future.get())
+     */
+    template <typename Result>
+    Result wait(std::future<Result>& future) {
+        while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            // Nothing left to help with: the awaited task is already running
+            if (!run_pending_task()) {
+                break;
+            }
+        }
+        return future.get();
+    }
+
+    /**
+     * @brief Run one queued task on the calling thread
+     * @return false if no task was queued
+     */
+    bool run_pending_task();
+
+    /**
+     * @brief Pool shared by all high-performance parsers
+     *
+     * Created on first use with the size last passed to set_shared_size()
+     * (hardware concurrency by default). Callers keep the returned pointer
+     * for the duration of a parse, so resizing never pulls a pool out from
+     * under running work.
+     */
+    static std::shared_ptr<ThreadPool> shared();
+
+    /**
+     * @brief Resize the shared pool
+     *
+     * Later parses use a new pool of @p num_threads workers (0 for hardware
+     * concurrency); the old pool finishes its queued tasks and exits once the
+     * last parse using it completes.
+     */
+    static void set_shared_size(std::size_t num_threads);
+
+    /**
+     * @brief Worker count of the shared pool (the configured size if not yet created)
+     */
+    static std::size_t shared_size();
+
+    /**
+     * @brief Release the shared pool; the next shared() call creates a new one
+     *
+     * Call before unloading the library so worker threads are joined outside
+     * of static destruction.
+     */
+    static void reset_shared();
+
+private:
+    struct State;
+
+    std::shared_ptr<State> state_;
+    std::vector<std::thread> threads_;
+
+    void enqueue(std::function<void()> task);
+};
+
+/**
+ * @brief Tasks submitted together whose results are collected in order
+ *
+ * Chunk tasks reference the caller's stack (the mapped file, the parser).
+ * The destructor waits for every task whose result was not collected, so an
+ * early error return or an exception cannot leave a task running against
+ * freed state.
+ */
+template <typename Result>
+class TaskGroup {
+public:
+    explicit TaskGroup(ThreadPool& pool) : pool_(pool) {}
+
+    ~TaskGroup() {
+        for (std::future<Result>& future : futures_) {
+            if (future.valid()) {
+                try {
+                    pool_.wait(future);
+                } catch (...) {
+                    // Result is no longer wanted
+                }
+            }
+        }
+    }
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    template <typename Func>
+    void submit(Func&& func) {
+        futures_.push_back(pool_.submit(std::forward<Func>(func)));
+    }
+
+    std::size_t size() const { return futures_.size(); }
+
+    /**
+     * @brief Wait for (and help with) task @p index and return its result
+     */
+    Result get(std::size_t index) { return pool_.wait(futures_[index]); }
+
+private:
+    ThreadPool& pool_;
+    std::vector<std::future<Result>> futures_;
+};
+
+} // namespace performance
+} // namespace coverage_parser
+
+#endif /* THREAD_POOL_H */
@@ -0,0 +1,290 @@
+/**
+ * @file trigram_index.h
+ * @brief Trigram index answering substring and glob queries over names
+ *
+ * A name containing "axi_wr" necessarily contains its trigrams "axi", "xi_",
+ * "i_w" and "_wr". The index keeps, for every trigram, the sorted list of
+ * entries whose name contains it (a posting list). A query intersects the
+ * posting lists of its trigrams, starting from the shortest, and verifies
+ * only the surviving candidates, instead of searching every name.
+ *
+ * Glob patterns support '*' (any run of characters) and '?' (any single
+ * character) and must match the whole name. Trigrams are taken from the
+ * literal fragments between wildcards. Queries with no trigram to narrow
+ * by (needles or fragments shorter than three characters) fall back to
+ * verifying every entry.
+ *
+ * Results are visited in the order of the table the index was built from.
+ *
+ * USAGE EXAMPLE:
+ * ```cpp
+ * const TrigramIndex<CoverageGroup>& groups = db.group_trigrams();
+ * groups.for_each_containing("axi_wr", [](std::string_view name, CoverageGroup* group) {
+ *     std::cout << name << std::endl;
+ * });
+ * std::vector<CoverageGroup*> fifos = groups.find_matching("tb.*.fifo_?::cg*");
+ * ```
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#ifndef TRIGRAM_INDEX_H
+#define TRIGRAM_INDEX_H
+
+#include "flat_hash_map.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace coverage_parser {
+
+/**
+ * @brief Posting lists of the trigrams in one database table's names
+ *
+ * Names are views of the table keys; the index is only valid while the
+ * table it was built from is unchanged.
+ */
+template <typename T>
+class TrigramIndex {
+public:
+    struct Entry {
+        std::string_view name;
+        T* record;
+    };
+
+    /**
+     * @brief Rebuild from a table mapping names to owning record pointers
+     *
+     * Two passes over the names: the first sizes every posting list, the
+     * second fills them into one shared array.
+     */
+    template <typename Table>
+    void assign(const Table& table) {
+        clear();
+        entries_.reserve(table.size());
+        for (const auto& [name, record] : table) {
+            if (record) {
+                entries_.push_back(Entry{name, record.get()});
+            }
+        }
+
+        // Pass 1: number of distinct entries per trigram. last_entry skips
+        // trigrams repeated within one name.
+        std::vector<std::uint32_t> counts;
+        std::vector<std::uint32_t> last_entry;
+        for (std::uint32_t id = 0; id < entries_.size(); ++id) {
+            std::string_view name = entries_[id].name;
+            for (std::size_t i = 0; i + 3 <= name.size(); ++i) {
+                auto [it, inserted] = slots_.try_emplace(trigram_at(name, i), static_cast<std::uint32_t>(counts.size()));
+                if (inserted) {
+                    counts.push_back(0);
+                    last_entry.push_back(NO_ENTRY);
+                }
+                const std::uint32_t slot = it->second;
+                if (last_entry[slot] != id) {
+                    last_entry[slot] = id;
+                    ++counts[slot];
+                }
+            }
+        }
+
+        offsets_.resize(counts.size() + 1);
+        offsets_[0] = 0;
+        for (std::size_t slot = 0; slot < counts.size(); ++slot) {
+            offsets_[slot + 1] = offsets_[slot] + counts[slot];
+        }
+
+        // Pass 2: fill. Entries are visited in ID order, so every posting
+        // list comes out sorted.
+        std::vector<std::uint32_t>& cursor = counts;
+        std::copy(offsets_.begin(), offsets_.end() - 1, cursor.begin());
+        std::fill(last_entry.begin(), last_entry.end(), NO_ENTRY);
+        postings_.resize(offsets_.back());
+        for (std::uint32_t id = 0; id < entries_.size(); ++id) {
+            std::string_view name = entries_[id].name;
+            for (std::size_t i = 0; i + 3 <= name.size(); ++i) {
+                const std::uint32_t slot = slots_.find(trigram_at(name, i))->second;
+                if (last_entry[slot] != id) {
+                    last_entry[slot] = id;
+                    postings_[cursor[slot]++] = id;
+                }
+            }
+        }
+    }
+
+    void clear() {
+        entries_.clear();
+        slots_.clear();
+        offsets_.clear();
+        postings_.clear();
+    }
+
+    std::size_t size() const { return entries_.size(); }
+    bool empty() const { return entries_.empty(); }
+
+    /**
+     * @brief Visit every entry whose name contains @p needle
+     */
+    template <typename Visitor>
+    void for_each_containing(std::string_view needle, Visitor&& visit) const {
+        std::vector<std::uint32_t> trigrams;
+        add_trigrams(needle, trigrams);
+        for_each_verified(trigrams, [needle](std::string_view name) { return name.find(needle) != std::string_view::npos; },
+                          visit);
+    }
+
+    /**
+     * @brief Visit every entry whose whole name matches @p glob ('*' and '?')
+     */
+    template <typename Visitor>
+    void for_each_matching(std::string_view glob, Visitor&& visit) const {
+        std::vector<std::uint32_t> trigrams;
+        std::size_t start = 0;
+        while (start <= glob.size()) {
+            std::size_t end = glob.find_first_of("*?", start);
+            if (end == std::string_view::npos) {
+                end = glob.size();
+            }
+            add_trigrams(glob.substr(start, end - start), trigrams);
+            start = end + 1;
+        }
+        for_each_verified(trigrams, [glob](std::string_view name) { return glob_match(glob, name); }, visit);
+    }
+
+    std::vector<T*> find_containing(std::string_view needle) const {
+        std::vector<T*> records;
+        for_each_containing(needle, [&records](std::string_view, T* record) { records.push_back(record); });
+        return records;
+    }
+
+    std::vector<T*> find_matching(std::string_view glob) const {
+        std::vector<T*> records;
+        for_each_matching(glob, [&records](std::string_view, T* record) { records.push_back(record); });
+        return records;
+    }
+
+    /**
+     * @brief Whether @p name matches @p glob in full ('*' and '?' wildcards)
+     */
+    static bool glob_match(std::string_view glob, std::string_view name) {
+        // Greedy match that backtracks to the most recent '*' on a mismatch
+        std::size_t g = 0;
+        std::size_t n = 0;
+        std::size_t star = std::string_view::npos;
+        std::size_t star_name = 0;
+        while (n < name.size()) {
+            if (g < glob.size() && (glob[g] == '?' || glob[g] == name[n])) {
+                ++g;
+                ++n;
+            } else if (g < glob.size() && glob[g] == '*') {
+                star = g++;
+                star_name = n;
+            } else if (star != std::string_view::npos) {
+                g = star + 1;
+                n = ++star_name;
+            } else {
+                return false;
+            }
+        }
+        while (g < glob.size() && glob[g] == '*') {
+            ++g;
+        }
+        return g == glob.size();
+    }
+
+private:
+    static constexpr std::uint32_t NO_ENTRY = static_cast<std::uint32_t>(-1);
+
+    std::vector<Entry>                          entries_;
+    FlatHashMap<std::uint32_t, std::uint32_t>   slots_;      /**< Trigram -> posting list */
+    std::vector<std::uint32_t>                  offsets_;    /**< Posting list i is postings_[offsets_[i], offsets_[i + 1]) */
+    std::vector<std::uint32_t>                  postings_;   /**< Entry IDs, sorted within each list */
+
+    static std::uint32_t trigram_at(std::string_view text, std::size_t i) {
+        return (static_cast<std::uint32_t>(static_cast<unsigned char>(text[i])) << 16) |
+               (static_cast<std::uint32_t>(static_cast<unsigned char>(text[i + 1])) << 8) |
+               static_cast<std::uint32_t>(static_cast<unsigned char>(text[i + 2]));
+    }
+
+    static void add_trigrams(std::string_view text, std::vector<std::uint32_t>& trigrams) {
+        for (std::size_t i = 0; i + 3 <= text.size(); ++i) {
+            trigrams.push_back(trigram_at(text, i));
+        }
+    }
+
+    // lower_bound of `id` in [first, last), probing 1, 2, 4, ... entries ahead
+    // first: costs O(log distance) rather than O(log list size)
+    static const std::uint32_t* gallop(const std::uint32_t* first, const std::uint32_t* last, std::uint32_t id) {
+        std::size_t step = 1;
+        while (static_cast<std::size_t>(last - first) > step && first[step] < id) {
+            first += step;
+            step *= 2;
+        }
+        return std::lower_bound(first, first + std::min(step + 1, static_cast<std::size_t>(last - first)), id);
+    }
+
+    // Verify the entries in every posting list of `trigrams` (or every entry
+    // if there are none) and visit those accepted by `matches`
+    template <typename Predicate, typename Visitor>
+    void for_each_verified(std::vector<std::uint32_t>& trigrams, Predicate&& matches, Visitor&& visit) const {
+        if (trigrams.empty()) {
+            for (const Entry& entry : entries_) {
+                if (matches(entry.name)) {
+                    visit(entry.name, entry.record);
+                }
+            }
+            return;
+        }
+
+        struct List {
+            const std::uint32_t* first;
+            const std::uint32_t* last;
+        };
+        std::sort(trigrams.begin(), trigrams.end());
+        trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+        std::vector<List> lists;
+        lists.reserve(trigrams.size());
+        for (std::uint32_t trigram : trigrams) {
+            auto it = slots_.find(trigram);
+            if (it == slots_.end()) {
+                return;  // No name contains this trigram
+            }
+            lists.push_back(List{postings_.data() + offsets_[it->second], postings_.data() + offsets_[it->second + 1]});
+        }
+        std::sort(lists.begin(), lists.end(),
+                  [](const List& lhs, const List& rhs) { return lhs.last - lhs.first < rhs.last - rhs.first; });
+
+        // Shortest list first: every candidate is looked up in the longer
+        // lists by galloping forward from where the previous lookup ended
+        std::vector<std::uint32_t> candidates(lists[0].first, lists[0].last);
+        for (std::size_t l = 1; l < lists.size() && !candidates.empty(); ++l) {
+            const std::uint32_t* position = lists[l].first;
+            std::size_t kept = 0;
+            for (std::uint32_t id : candidates) {
+                position = gallop(position, lists[l].last, id);
+                if (position == lists[l].last) {
+                    break;
+                }
+                if (*position == id) {
+                    candidates[kept++] = id;
+                }
+            }
+            candidates.resize(kept);
+        }
+
+        for (std::uint32_t id : candidates) {
+            const Entry& entry = entries_[id];
+            if (matches(entry.name)) {
+                visit(entry.name, entry.record);
+            }
+        }
+    }
+};
+
+} // namespace coverage_parser
+
+#endif /* TRIGRAM_INDEX_H */
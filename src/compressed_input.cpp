@@ -0,0 +1,506 @@
+/**
+ * @file compressed_input.cpp
+ * @brief Implementation of gzip and zstd report decompression
+ *
+ * Both formats are driven through one Decoder interface: the stream buffer
+ * feeds it fixed-size blocks of the file, decompress_buffer() feeds it the
+ * whole mapping. Multi-frame zstd files whose frames record their content
+ * size skip the decoder and decompress frame by frame in parallel.
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#include "../include/compressed_input.h"
+#include "../include/high_performance_parser.h"
+#include "../include/thread_pool.h"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <ios>
+#include <vector>
+
+#if COVERAGE_PARSER_HAVE_ZLIB
+#include <zlib.h>
+#endif
+#if COVERAGE_PARSER_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+namespace coverage_parser {
+
+namespace {
+
+constexpr std::size_t STREAM_BLOCK_SIZE = 256 * 1024;
+
+// Smaller zstd files are decompressed on the calling thread
+constexpr std::size_t PARALLEL_FRAME_BYTES = 1024 * 1024;
+
+/**
+ * @brief Incremental decompressor of one format
+ *
+ * decode() advances @p in and @p out past what it consumed and produced.
+ * It may produce output from internal state with no input left, so callers
+ * keep calling it while it makes progress.
+ */
+class Decoder {
+public:
+    virtual ~Decoder() = default;
+
+    /**
+     * @return false if the input is corrupt
+     */
+    virtual bool decode(const char*& in, const char* in_end, char*& out, char* out_end) = 0;
+
+    /**
+     * @brief Whether the input so far ends between members/frames (not truncated)
+     */
+    virtual bool at_boundary() const = 0;
+
+    virtual void reset() = 0;
+};
+
+#if COVERAGE_PARSER_HAVE_ZLIB
+class GzipDecoder : public Decoder {
+public:
+    GzipDecoder() {
+        std::memset(&stream_, 0, sizeof(stream_));
+        if (inflateInit2(&stream_, 15 + 16) != Z_OK) {  // 15-bit window, gzip header
+            throw std::bad_alloc();
+        }
+    }
+
+    ~GzipDecoder() override { inflateEnd(&stream_); }
+
+    bool decode(const char*& in, const char* in_end, char*& out, char* out_end) override {
+        // Runs with no input left too: zlib may hold output that did not fit
+        while (out < out_end) {
+            if (finished_) {
+                if (in == in_end) {
+                    break;
+                }
+                // Anything after the last member other than a new member
+                // header is padding, which gzip itself ignores too
+                if (static_cast<unsigned char>(*in) != 0x1F) {
+                    in = in_end;
+                    break;
+                }
+                inflateReset(&stream_);
+                finished_ = false;
+            }
+            stream_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(in));
+            stream_.avail_in = static_cast<uInt>(std::min<std::size_t>(in_end - in, UINT_MAX));
+            stream_.next_out = reinterpret_cast<Bytef*>(out);
+            stream_.avail_out = static_cast<uInt>(std::min<std::size_t>(out_end - out, UINT_MAX));
+            const int status = inflate(&stream_, Z_NO_FLUSH);
+            const bool progressed = reinterpret_cast<const char*>(stream_.next_in) != in ||
+                                    reinterpret_cast<char*>(stream_.next_out) != out;
+            in = reinterpret_cast<const char*>(stream_.next_in);
+            out = reinterpret_cast<char*>(stream_.next_out);
+            if (status == Z_STREAM_END) {
+                finished_ = true;  // Concatenated members follow, if any
+            } else if (status == Z_BUF_ERROR || (status == Z_OK && !progressed)) {
+                break;  // Needs more input
+            } else if (status != Z_OK) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool at_boundary() const override { return finished_; }
+
+    void reset() override {
+        inflateReset(&stream_);
+        finished_ = false;
+    }
+
+private:
+    z_stream stream_;
+    bool     finished_ = false;
+};
+#endif
+
+#if COVERAGE_PARSER_HAVE_ZSTD
+class ZstdDecoder : public Decoder {
+public:
+    ZstdDecoder() : context_(ZSTD_createDCtx()) {
+        if (!context_) {
+            throw std::bad_alloc();
+        }
+    }
+
+    ~ZstdDecoder() override { ZSTD_freeDCtx(context_); }
+
+    bool decode(const char*& in, const char* in_end, char*& out, char* out_end) override {
+        // Frames follow each other: the stream starts the next one by itself
+        ZSTD_inBuffer input{in, static_cast<std::size_t>(in_end - in), 0};
+        ZSTD_outBuffer output{out, static_cast<std::size_t>(out_end - out), 0};
+        const std::size_t status = ZSTD_decompressStream(context_, &output, &input);
+        if (ZSTD_isError(status)) {
+            return false;
+        }
+        in += input.pos;
+        out += output.pos;
+        if (input.pos != 0 || output.pos != 0) {
+            boundary_ = status == 0;  // A call with nothing to do reports the next frame's needs
+        }
+        return true;
+    }
+
+    bool at_boundary() const override { return boundary_; }
+
+    void reset() override {
+        ZSTD_DCtx_reset(context_, ZSTD_reset_session_only);
+        boundary_ = false;
+    }
+
+private:
+    ZSTD_DCtx* context_;
+    bool       boundary_ = false;
+};
+#endif
+
+std::unique_ptr<Decoder> make_decoder(Compression compression) {
+    switch (compression) {
+#if COVERAGE_PARSER_HAVE_ZLIB
+        case Compression::GZIP:
+            return std::make_unique<GzipDecoder>();
+#endif
+#if COVERAGE_PARSER_HAVE_ZSTD
+        case Compression::ZSTD:
+            return std::make_unique<ZstdDecoder>();
+#endif
+        default:
+            return nullptr;
+    }
+}
+
+/**
+ * @brief Stream buffer that decompresses a file block by block
+ *
+ * Corrupt or truncated input throws from underflow(), which the istream
+ * turns into badbit.
+ */
+class DecompressingBuffer : public std::streambuf {
+public:
+    DecompressingBuffer(std::ifstream&& file, std::unique_ptr<Decoder> decoder)
+        : file_(std::move(file)), decoder_(std::move(decoder)), input_(STREAM_BLOCK_SIZE), output_(STREAM_BLOCK_SIZE) {
+        setg(output_.data(), output_.data(), output_.data());
+    }
+
+protected:
+    int_type underflow() override {
+        if (gptr() < egptr()) {
+            return traits_type::to_int_type(*gptr());
+        }
+        for (;;) {
+            if (in_ == in_end_ && !file_eof_) {
+                file_.read(input_.data(), static_cast<std::streamsize>(input_.size()));
+                in_ = input_.data();
+                in_end_ = in_ + file_.gcount();
+                file_eof_ = !file_;
+            }
+
+            char* out = output_.data();
+            const char* before = in_;
+            if (!decoder_->decode(in_, in_end_, out, output_.data() + output_.size())) {
+                throw std::ios_base::failure("corrupt compressed input");
+            }
+            if (out != output_.data()) {
+                setg(output_.data(), output_.data(), out);
+                return traits_type::to_int_type(*gptr());
+            }
+            if (in_ == before && in_ != in_end_) {
+                throw std::ios_base::failure("corrupt compressed input");  // Stuck: cannot happen with valid data
+            }
+            if (in_ == before && file_eof_) {
+                if (!decoder_->at_boundary()) {
+                    throw std::ios_base::failure("truncated compressed input");
+                }
+                return traits_type::eof();
+            }
+        }
+    }
+
+    // Only rewinding to the start is supported
+    pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode) override {
+        return (offset == 0 && direction == std::ios_base::beg) ? rewind() : pos_type(off_type(-1));
+    }
+
+    pos_type seekpos(pos_type position, std::ios_base::openmode) override {
+        return position == pos_type(0) ? rewind() : pos_type(off_type(-1));
+    }
+
+private:
+    std::ifstream             file_;
+    std::unique_ptr<Decoder>  decoder_;
+    std::vector<char>         input_;
+    std::vector<char>         output_;
+    const char*               in_ = nullptr;
+    const char*               in_end_ = nullptr;
+    bool                      file_eof_ = false;
+
+    pos_type rewind() {
+        file_.clear();
+        file_.seekg(0, std::ios_base::beg);
+        if (!file_) {
+            return pos_type(off_type(-1));
+        }
+        decoder_->reset();
+        in_ = in_end_ = nullptr;
+        file_eof_ = false;
+        setg(output_.data(), output_.data(), output_.data());
+        return pos_type(0);
+    }
+};
+
+// Decode all of [data, data + size) into a buffer grown as needed
+bool decode_whole(Decoder& decoder, const char* data, std::size_t size, std::size_t size_hint,
+                  std::unique_ptr<char[]>& output, std::size_t& output_size) {
+    std::size_t capacity = std::max<std::size_t>(size_hint, STREAM_BLOCK_SIZE) + 1;
+    std::unique_ptr<char[]> buffer(new char[capacity]);
+    const char* in = data;
+    const char* in_end = data + size;
+    std::size_t used = 0;
+    for (;;) {
+        char* out = buffer.get() + used;
+        const char* before = in;
+        if (!decoder.decode(in, in_end, out, buffer.get() + capacity - 1)) {
+            return false;
+        }
+        const bool progressed = out != buffer.get() + used || in != before;
+        used = static_cast<std::size_t>(out - buffer.get());
+        if (!progressed) {
+            break;
+        }
+        if (used == capacity - 1) {
+            const std::size_t grown = capacity * 2;
+            std::unique_ptr<char[]> larger(new char[grown]);
+            std::memcpy(larger.get(), buffer.get(), used);
+            buffer = std::move(larger);
+            capacity = grown;
+        }
+    }
+    if (!decoder.at_boundary()) {
+        return false;
+    }
+    buffer[used] = '\0';
+    output = std::move(buffer);
+    output_size = used;
+    return true;
+}
+
+#if COVERAGE_PARSER_HAVE_ZSTD
+// Skippable frames carry metadata, not content (magic 0x184D2A50 to 0x184D2A5F)
+bool is_skippable_frame(const char* frame) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(frame);
+    return (bytes[0] & 0xF0) == 0x50 && bytes[1] == 0x2A && bytes[2] == 0x4D && bytes[3] == 0x18;
+}
+
+struct ZstdFrame {
+    const char* input;
+    std::size_t input_size;
+    std::size_t output_offset;
+    std::size_t output_size;
+};
+
+/**
+ * @brief Locate every content frame and its place in the output
+ * @return false if a frame does not record its content size or the data is corrupt
+ */
+bool list_zstd_frames(const char* data, std::size_t size, std::vector<ZstdFrame>& frames, std::size_t& total) {
+    total = 0;
+    for (std::size_t offset = 0; offset < size;) {
+        const std::size_t frame_size = ZSTD_findFrameCompressedSize(data + offset, size - offset);
+        if (ZSTD_isError(frame_size)) {
+            return false;
+        }
+        if (!is_skippable_frame(data + offset)) {
+            const unsigned long long content = ZSTD_getFrameContentSize(data + offset, frame_size);
+            if (content == ZSTD_CONTENTSIZE_UNKNOWN || content == ZSTD_CONTENTSIZE_ERROR) {
+                return false;
+            }
+            frames.push_back(ZstdFrame{data + offset, frame_size, total, static_cast<std::size_t>(content)});
+            total += static_cast<std::size_t>(content);
+        }
+        offset += frame_size;
+    }
+    return true;
+}
+
+/**
+ * @brief Decompress every frame into its own place in the output, in parallel
+ * @return false if a frame does not record its content size (the caller
+ *         falls back to streaming) or if the data is corrupt
+ */
+bool decompress_zstd_frames(const char* data, std::size_t size, std::unique_ptr<char[]>& output,
+                            std::size_t& output_size) {
+    std::vector<ZstdFrame> frames;
+    std::size_t total = 0;
+    if (!list_zstd_frames(data, size, frames, total)) {
+        return false;
+    }
+
+    std::unique_ptr<char[]> buffer(new char[total + 1]);
+    auto decompress_frame = [&buffer](const ZstdFrame& frame) {
+        const std::size_t written = ZSTD_decompress(buffer.get() + frame.output_offset, frame.output_size,
+                                                    frame.input, frame.input_size);
+        return !ZSTD_isError(written) && written == frame.output_size;
+    };
+
+    bool intact = true;
+    if (frames.size() > 1 && size >= PARALLEL_FRAME_BYTES) {
+        std::shared_ptr<performance::ThreadPool> pool = performance::ThreadPool::shared();
+        performance::TaskGroup<bool> tasks(*pool);
+        for (const ZstdFrame& frame : frames) {
+            tasks.submit([&decompress_frame, frame]() { return decompress_frame(frame); });
+        }
+        for (std::size_t i = 0; i < tasks.size(); ++i) {
+            intact = tasks.get(i) && intact;
+        }
+    } else {
+        for (const ZstdFrame& frame : frames) {
+            intact = intact && decompress_frame(frame);
+        }
+    }
+    if (!intact) {
+        return false;
+    }
+    buffer[total] = '\0';
+    output = std::move(buffer);
+    output_size = total;
+    return true;
+}
+#endif
+
+} // anonymous namespace
+
+// ============================================================================
+// Format Detection
+// ============================================================================
+
+Compression detect_compression(const void* data, std::size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    if (size >= 2 && bytes[0] == 0x1F && bytes[1] == 0x8B) {
+        return Compression::GZIP;
+    }
+    if (size >= 4 && bytes[0] == 0x28 && bytes[1] == 0xB5 && bytes[2] == 0x2F && bytes[3] == 0xFD) {
+        return Compression::ZSTD;
+    }
+    return Compression::NONE;
+}
+
+bool compression_supported(Compression compression) {
+    switch (compression) {
+        case Compression::NONE:
+            return true;
+#if COVERAGE_PARSER_HAVE_ZLIB
+        case Compression::GZIP:
+            return true;
+#endif
+#if COVERAGE_PARSER_HAVE_ZSTD
+        case Compression::ZSTD:
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+// ============================================================================
+// Whole-Buffer Decompression
+// ============================================================================
+
+bool decompress_buffer(const char* data, std::size_t size, Compression compression,
+                       std::unique_ptr<char[]>& output, std::size_t& output_size) {
+    try {
+        std::size_t size_hint = size * 4;
+#if COVERAGE_PARSER_HAVE_ZSTD
+        if (compression == Compression::ZSTD && decompress_zstd_frames(data, size, output, output_size)) {
+            return true;
+        }
+#endif
+        if (compression == Compression::GZIP && size >= 18) {
+            // The trailer of the last member holds its size modulo 2^32
+            std::uint32_t last_member_size;
+            std::memcpy(&last_member_size, data + size - 4, sizeof(last_member_size));
+            size_hint = std::max<std::size_t>(size_hint, last_member_size);
+        }
+        std::unique_ptr<Decoder> decoder = make_decoder(compression);
+        return decoder && decode_whole(*decoder, data, size, size_hint, output, output_size);
+    } catch (const std::bad_alloc&) {
+        return false;
+    }
+}
+
+std::size_t report_content_size(const std::string& filename) {
+    // Only the headers and the gzip trailer are read: map, don't decompress
+    performance::MemoryMappedFile file(filename, performance::MemoryMappedFile::Access::RANDOM);
+    if (!file.is_valid()) {
+        return utils::get_file_size(filename);
+    }
+    const char* data = file.data();
+    const std::size_t size = file.size();
+    switch (detect_compression(data, size)) {
+        case Compression::GZIP:
+            if (size >= 18) {
+                // Deflate never expands text to twice its size, so a smaller
+                // trailer belongs to the last of several members or wrapped
+                std::uint32_t last_member_size;
+                std::memcpy(&last_member_size, data + size - 4, sizeof(last_member_size));
+                return last_member_size >= size / 2 ? last_member_size : size;
+            }
+            return size;
+#if COVERAGE_PARSER_HAVE_ZSTD
+        case Compression::ZSTD: {
+            std::vector<ZstdFrame> frames;
+            std::size_t content = 0;
+            return list_zstd_frames(data, size, frames, content) ? content : size;
+        }
+#endif
+        default:
+            return size;
+    }
+}
+
+// ============================================================================
+// ReportStream Implementation
+// ============================================================================
+
+ReportStream::ReportStream(const std::string& filename) : std::istream(nullptr) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        setstate(std::ios::failbit);
+        return;
+    }
+    char magic[4] = {};
+    file.read(magic, sizeof(magic));
+    compression_ = detect_compression(magic, static_cast<std::size_t>(file.gcount()));
+
+    if (compression_ == Compression::NONE) {
+        // Plain text: the same buffer std::ifstream would use
+        auto plain = std::make_unique<std::filebuf>();
+        if (!plain->open(filename, std::ios::in)) {
+            setstate(std::ios::failbit);
+            return;
+        }
+        buffer_ = std::move(plain);
+    } else {
+        std::unique_ptr<Decoder> decoder = make_decoder(compression_);
+        if (!decoder) {
+            setstate(std::ios::failbit);
+            return;
+        }
+        file.clear();
+        file.seekg(0, std::ios::beg);
+        buffer_ = std::make_unique<DecompressingBuffer>(std::move(file), std::move(decoder));
+    }
+    rdbuf(buffer_.get());
+}
+
+ReportStream::~ReportStream() = default;
+
+} // namespace coverage_parser
@@ -13,96 +13,425 @@
 
 #include "../include/coverage_types.h"
 #include "../include/functional_coverage_parser.h"
+#include "../include/memory_pool.h"
 #include <algorithm>
 #include <sstream>
 #include <iomanip>
+#include <thread>
 
 namespace coverage_parser {
 
+namespace {
+
+// Read-only view of a query result, for the const query overloads
+template <typename T>
+std::vector<const T*> const_records(const std::vector<T*>& records) {
+    return std::vector<const T*>(records.begin(), records.end());
+}
+
+// Records are ~100 bytes: large chunks keep the chunk list short for
+// databases holding millions of them
+constexpr std::size_t ARENA_CHUNK_SIZE = 1024 * 1024;
+
+// A few shards per core, so concurrent workers rarely want the same shard
+std::size_t default_ingest_shards() {
+    const unsigned cores = std::thread::hardware_concurrency();
+    return 4 * static_cast<std::size_t>(cores > 0 ? cores : 1);
+}
+
+// Intern each record's name and stage the batch; unnamed records keep an
+// empty key, which the staging table skips
+template <typename T, typename NameOf>
+void stage_records(ShardedIngest<RecordPtr<T>>& staging, StringInterner& strings, std::uint32_t batch,
+                   RecordPtr<T>* records, std::size_t count, NameOf name_of) {
+    std::vector<std::string_view> keys(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (records[i] && !name_of(*records[i]).empty()) {
+            keys[i] = strings.intern(name_of(*records[i]));
+        }
+    }
+    staging.insert(batch, keys.data(), records, count);
+}
+
+} // anonymous namespace
+
 // Constructor
-CoverageDatabase::CoverageDatabase() {
+CoverageDatabase::CoverageDatabase(StorageMode mode)
+    : storage_mode_(mode),
+      arena_(mode == StorageMode::ARENA ? std::make_unique<performance::MemoryPool>(ARENA_CHUNK_SIZE) : nullptr) {
     reset();
 }
 
+CoverageDatabase::~CoverageDatabase() {
+    clear_tables();
+}
+
+CoverageDatabase::CoverageDatabase(CoverageDatabase&& other)
+    : dashboard_data(std::move(other.dashboard_data)),
+      groups_table(std::move(other.groups_table)),
+      hierarchy_table(std::move(other.hierarchy_table)),
+      modules_table(std::move(other.modules_table)),
+      asserts_table(std::move(other.asserts_table)),
+      last_updated(other.last_updated),
+      is_valid(other.is_valid),
+      storage_mode_(other.storage_mode_),
+      arena_(std::move(other.arena_)) {
+    // Table keys refer to the interned strings; `other` keeps a valid empty store
+    strings_.swap(other.strings_);
+    hierarchy_tree_ = std::move(other.hierarchy_tree_);
+    other.hierarchy_tree_.clear();
+    ingest_ = std::move(other.ingest_);
+    other.invalidate_group_columns();
+    other.invalidate_hierarchy_rollups();
+    other.invalidate_search_indexes();
+}
+
+CoverageDatabase& CoverageDatabase::operator=(CoverageDatabase&& other) {
+    if (this != &other) {
+        // Our records may live in the arena about to be replaced
+        clear_tables();
+        dashboard_data = std::move(other.dashboard_data);
+        groups_table = std::move(other.groups_table);
+        hierarchy_table = std::move(other.hierarchy_table);
+        modules_table = std::move(other.modules_table);
+        asserts_table = std::move(other.asserts_table);
+        last_updated = other.last_updated;
+        is_valid = other.is_valid;
+        storage_mode_ = other.storage_mode_;
+        arena_ = std::move(other.arena_);
+        strings_.swap(other.strings_);
+        hierarchy_tree_ = std::move(other.hierarchy_tree_);
+        other.hierarchy_tree_.clear();
+        ingest_ = std::move(other.ingest_);
+        invalidate_hierarchy_rollups();
+        invalidate_search_indexes();
+        other.invalidate_group_columns();
+        other.invalidate_hierarchy_rollups();
+        other.invalidate_search_indexes();
+    }
+    return *this;
+}
+
+// Storage methods
+std::size_t CoverageDatabase::arena_bytes() const {
+    return arena_ ? arena_->total_allocated() : 0;
+}
+
+template <typename T>
+RecordPtr<T> CoverageDatabase::create_record() {
+    if (!arena_) {
+        return RecordPtr<T>(new T());
+    }
+    void* memory = arena_->allocate(sizeof(T), alignof(T));
+    if (!memory) {
+        throw std::bad_alloc();
+    }
+    return RecordPtr<T>(new (memory) T(), RecordDeleter<T>(true));
+}
+
+RecordPtr<CoverageGroup> CoverageDatabase::create_coverage_group() {
+    return create_record<CoverageGroup>();
+}
+
+RecordPtr<HierarchyInstance> CoverageDatabase::create_hierarchy_instance() {
+    return create_record<HierarchyInstance>();
+}
+
+RecordPtr<ModuleDefinition> CoverageDatabase::create_module_definition() {
+    return create_record<ModuleDefinition>();
+}
+
+RecordPtr<AssertCoverage> CoverageDatabase::create_assert_coverage() {
+    return create_record<AssertCoverage>();
+}
+
+template <typename T>
+void CoverageDatabase::reserve_records(FlatHashMap<std::string_view, RecordPtr<T>>& table, std::size_t count) {
+    if (count <= table.size()) {
+        return;
+    }
+    const std::size_t added = count - table.size();
+    table.reserve(count);
+    strings_.reserve(strings_.size() + added);  // Each record brings at least its name
+    if (arena_ && !arena_->reserve(added * sizeof(T))) {
+        throw std::bad_alloc();
+    }
+}
+
+void CoverageDatabase::reserve_coverage_groups(std::size_t count) {
+    reserve_records(groups_table, count);
+}
+
+void CoverageDatabase::reserve_hierarchy_instances(std::size_t count) {
+    reserve_records(hierarchy_table, count);
+    hierarchy_tree_.reserve(count);  // At least one node per instance
+}
+
+void CoverageDatabase::reserve_hierarchy_nodes(std::size_t count) {
+    hierarchy_tree_.reserve(count);
+}
+
+void CoverageDatabase::reserve_module_definitions(std::size_t count) {
+    reserve_records(modules_table, count);
+}
+
+void CoverageDatabase::reserve_assert_coverage(std::size_t count) {
+    reserve_records(asserts_table, count);
+}
+
+RecordString CoverageDatabase::make_string(std::string_view text) {
+    if (!arena_ || text.empty()) {
+        return RecordString(text);
+    }
+    char* buffer = static_cast<char*>(arena_->allocate(text.size() + 1, 1));
+    if (!buffer) {
+        throw std::bad_alloc();
+    }
+    std::memcpy(buffer, text.data(), text.size());
+    buffer[text.size()] = '\0';
+    return RecordString::external(buffer, text.size());
+}
+
+RecordString CoverageDatabase::intern(std::string_view text) {
+    std::string_view stored = strings_.intern(text);
+    return RecordString::external(stored.data(), stored.size());
+}
+
 // Query methods
-CoverageGroup* CoverageDatabase::find_coverage_group(const std::string& name) {
+CoverageGroup* CoverageDatabase::find_coverage_group(std::string_view name) {
+    invalidate_group_columns();  // The caller may modify the group
     auto it = groups_table.find(name);
     return (it != groups_table.end()) ? it->second.get() : nullptr;
 }
 
-const CoverageGroup* CoverageDatabase::find_coverage_group(const std::string& name) const {
+const CoverageGroup* CoverageDatabase::find_coverage_group(std::string_view name) const {
     auto it = groups_table.find(name);
     return (it != groups_table.end()) ? it->second.get() : nullptr;
 }
 
-HierarchyInstance* CoverageDatabase::find_hierarchy_instance(const std::string& path) {
+HierarchyInstance* CoverageDatabase::find_hierarchy_instance(std::string_view path) {
+    invalidate_hierarchy_rollups();  // The caller may modify the instance
     auto it = hierarchy_table.find(path);
     return (it != hierarchy_table.end()) ? it->second.get() : nullptr;
 }
 
-const HierarchyInstance* CoverageDatabase::find_hierarchy_instance(const std::string& path) const {
+const HierarchyInstance* CoverageDatabase::find_hierarchy_instance(std::string_view path) const {
     auto it = hierarchy_table.find(path);
     return (it != hierarchy_table.end()) ? it->second.get() : nullptr;
 }
 
-ModuleDefinition* CoverageDatabase::find_module_definition(const std::string& name) {
+ModuleDefinition* CoverageDatabase::find_module_definition(std::string_view name) {
     auto it = modules_table.find(name);
     return (it != modules_table.end()) ? it->second.get() : nullptr;
 }
 
-const ModuleDefinition* CoverageDatabase::find_module_definition(const std::string& name) const {
+const ModuleDefinition* CoverageDatabase::find_module_definition(std::string_view name) const {
     auto it = modules_table.find(name);
     return (it != modules_table.end()) ? it->second.get() : nullptr;
 }
 
-AssertCoverage* CoverageDatabase::find_assert_coverage(const std::string& name) {
+AssertCoverage* CoverageDatabase::find_assert_coverage(std::string_view name) {
     auto it = asserts_table.find(name);
     return (it != asserts_table.end()) ? it->second.get() : nullptr;
 }
 
-const AssertCoverage* CoverageDatabase::find_assert_coverage(const std::string& name) const {
+const AssertCoverage* CoverageDatabase::find_assert_coverage(std::string_view name) const {
     auto it = asserts_table.find(name);
     return (it != asserts_table.end()) ? it->second.get() : nullptr;
 }
 
-// Data manipulation methods
-void CoverageDatabase::add_coverage_group(std::unique_ptr<CoverageGroup> group) {
+// Data manipulation methods (table keys are interned copies of the record name)
+void CoverageDatabase::add_coverage_group(RecordPtr<CoverageGroup> group) {
     if (group && !group->name.empty()) {
-        groups_table[group->name] = std::move(group);
+        groups_table[strings_.intern(group->name)] = std::move(group);
+        invalidate_group_columns();
+        group_index_valid_.store(false, std::memory_order_release);
+        group_trigrams_valid_.store(false, std::memory_order_release);
         update_timestamp();
     }
 }
 
-void CoverageDatabase::add_hierarchy_instance(std::unique_ptr<HierarchyInstance> instance) {
+void CoverageDatabase::add_hierarchy_instance(RecordPtr<HierarchyInstance> instance) {
     if (instance && !instance->instance_path.empty()) {
-        hierarchy_table[instance->instance_path] = std::move(instance);
+        std::string_view path = strings_.intern(instance->instance_path);
+        hierarchy_tree_.insert(path, instance.get());
+        hierarchy_table[path] = std::move(instance);
+        invalidate_hierarchy_rollups();
+        instance_index_valid_.store(false, std::memory_order_release);
+        instance_trigrams_valid_.store(false, std::memory_order_release);
         update_timestamp();
     }
 }
 
-void CoverageDatabase::add_module_definition(std::unique_ptr<ModuleDefinition> module) {
+void CoverageDatabase::add_module_definition(RecordPtr<ModuleDefinition> module) {
     if (module && !module->module_name.empty()) {
-        modules_table[module->module_name] = std::move(module);
+        modules_table[strings_.intern(module->module_name)] = std::move(module);
         update_timestamp();
     }
 }
 
-void CoverageDatabase::add_assert_coverage(std::unique_ptr<AssertCoverage> assert_cov) {
+void CoverageDatabase::add_assert_coverage(RecordPtr<AssertCoverage> assert_cov) {
     if (assert_cov && !assert_cov->assert_name.empty()) {
-        asserts_table[assert_cov->assert_name] = std::move(assert_cov);
+        asserts_table[strings_.intern(assert_cov->assert_name)] = std::move(assert_cov);
+        assert_index_valid_.store(false, std::memory_order_release);
+        assert_trigrams_valid_.store(false, std::memory_order_release);
         update_timestamp();
     }
 }
 
+// Sharded ingest methods
+struct CoverageDatabase::IngestShards {
+    explicit IngestShards(std::size_t shards) : groups(shards), instances(shards), modules(shards), asserts(shards) {}
+    
+    ShardedIngest<RecordPtr<CoverageGroup>>      groups;
+    ShardedIngest<RecordPtr<HierarchyInstance>>  instances;
+    ShardedIngest<RecordPtr<ModuleDefinition>>   modules;
+    ShardedIngest<RecordPtr<AssertCoverage>>     asserts;
+};
+
+void CoverageDatabase::begin_ingest(std::size_t shards) {
+    ingest_ = std::make_unique<IngestShards>(shards > 0 ? shards : default_ingest_shards());
+}
+
+void CoverageDatabase::ingest_coverage_groups(std::uint32_t batch, RecordPtr<CoverageGroup>* records, std::size_t count) {
+    if (!ingest_) {
+        for (std::size_t i = 0; i < count; ++i) {
+            add_coverage_group(std::move(records[i]));
+        }
+        return;
+    }
+    stage_records(ingest_->groups, strings_, batch, records, count,
+                  [](const CoverageGroup& group) -> const RecordString& { return group.name; });
+}
+
+void CoverageDatabase::ingest_hierarchy_instances(std::uint32_t batch, RecordPtr<HierarchyInstance>* records, std::size_t count) {
+    if (!ingest_) {
+        for (std::size_t i = 0; i < count; ++i) {
+            add_hierarchy_instance(std::move(records[i]));
+        }
+        return;
+    }
+    stage_records(ingest_->instances, strings_, batch, records, count,
+                  [](const HierarchyInstance& instance) -> const RecordString& { return instance.instance_path; });
+}
+
+void CoverageDatabase::ingest_module_definitions(std::uint32_t batch, RecordPtr<ModuleDefinition>* records, std::size_t count) {
+    if (!ingest_) {
+        for (std::size_t i = 0; i < count; ++i) {
+            add_module_definition(std::move(records[i]));
+        }
+        return;
+    }
+    stage_records(ingest_->modules, strings_, batch, records, count,
+                  [](const ModuleDefinition& module) -> const RecordString& { return module.module_name; });
+}
+
+void CoverageDatabase::ingest_assert_coverage(std::uint32_t batch, RecordPtr<AssertCoverage>* records, std::size_t count) {
+    if (!ingest_) {
+        for (std::size_t i = 0; i < count; ++i) {
+            add_assert_coverage(std::move(records[i]));
+        }
+        return;
+    }
+    stage_records(ingest_->asserts, strings_, batch, records, count,
+                  [](const AssertCoverage& assert_cov) -> const RecordString& { return assert_cov.assert_name; });
+}
+
+void CoverageDatabase::finish_ingest() {
+    if (!ingest_) {
+        return;
+    }
+    std::unique_ptr<IngestShards> staged = std::move(ingest_);
+    
+    // Keys are already interned and unique per kind: one pre-sized insert each
+    if (staged->groups.size() > 0) {
+        groups_table.reserve(groups_table.size() + staged->groups.size());
+        staged->groups.drain([this](std::string_view key, RecordPtr<CoverageGroup>&& group, std::uint64_t) {
+            groups_table[key] = std::move(group);
+        });
+        invalidate_group_columns();
+        group_index_valid_.store(false, std::memory_order_release);
+        group_trigrams_valid_.store(false, std::memory_order_release);
+    }
+    
+    // Instances go in file order, which the tree keeps as child order
+    if (staged->instances.size() > 0) {
+        struct StagedInstance {
+            std::uint64_t order;
+            std::string_view path;
+            RecordPtr<HierarchyInstance> instance;
+        };
+        std::vector<StagedInstance> instances;
+        instances.reserve(staged->instances.size());
+        staged->instances.drain([&instances](std::string_view path, RecordPtr<HierarchyInstance>&& instance, std::uint64_t order) {
+            instances.push_back(StagedInstance{order, path, std::move(instance)});
+        });
+        std::sort(instances.begin(), instances.end(),
+                  [](const StagedInstance& lhs, const StagedInstance& rhs) { return lhs.order < rhs.order; });
+        
+        hierarchy_table.reserve(hierarchy_table.size() + instances.size());
+        hierarchy_tree_.reserve(hierarchy_tree_.size() + instances.size());
+        for (StagedInstance& staged_instance : instances) {
+            hierarchy_tree_.insert(staged_instance.path, staged_instance.instance.get());
+            hierarchy_table[staged_instance.path] = std::move(staged_instance.instance);
+        }
+        invalidate_hierarchy_rollups();
+        instance_index_valid_.store(false, std::memory_order_release);
+        instance_trigrams_valid_.store(false, std::memory_order_release);
+    }
+    
+    if (staged->modules.size() > 0) {
+        modules_table.reserve(modules_table.size() + staged->modules.size());
+        staged->modules.drain([this](std::string_view key, RecordPtr<ModuleDefinition>&& module, std::uint64_t) {
+            modules_table[key] = std::move(module);
+        });
+    }
+    
+    if (staged->asserts.size() > 0) {
+        asserts_table.reserve(asserts_table.size() + staged->asserts.size());
+        staged->asserts.drain([this](std::string_view key, RecordPtr<AssertCoverage>&& assert_cov, std::uint64_t) {
+            asserts_table[key] = std::move(assert_cov);
+        });
+        assert_index_valid_.store(false, std::memory_order_release);
+        assert_trigrams_valid_.store(false, std::memory_order_release);
+    }
+    
+    update_timestamp();
+}
+
+void CoverageDatabase::cancel_ingest() {
+    ingest_.reset();
+}
+
 // Utility methods
 void CoverageDatabase::reset() {
     dashboard_data.reset();
+    clear_tables();
+    strings_.clear();
+    if (arena_) {
+        arena_->reset();
+    }
+    is_valid = false;
+    update_timestamp();
+}
+
+void CoverageDatabase::clear_tables() {
+    ingest_.reset();  // Staged records may live in the arena too
+    invalidate_group_columns();
+    group_columns_.clear();
+    invalidate_hierarchy_rollups();
+    hierarchy_tree_.clear();
+    invalidate_search_indexes();
+    group_index_.clear();
+    instance_index_.clear();
+    assert_index_.clear();
+    group_trigrams_.clear();
+    instance_trigrams_.clear();
+    assert_trigrams_.clear();
     groups_table.clear();
     hierarchy_table.clear();
     modules_table.clear();
     asserts_table.clear();
-    is_valid = false;
-    update_timestamp();
 }
 
 bool CoverageDatabase::validate() const {
@@ -146,71 +475,250 @@ bool CoverageDatabase::validate() const {
     return true;
 }
 
-double CoverageDatabase::calculate_overall_score() const {
-    if (groups_table.empty()) {
-        return 0.0;
+// Hierarchy index (the tree itself is extended by add_hierarchy_instance())
+const HierarchyTree& CoverageDatabase::hierarchy_tree() const {
+    if (!hierarchy_rollups_valid_.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(hierarchy_rollups_mutex_);
+        if (!hierarchy_rollups_valid_.load(std::memory_order_relaxed)) {
+            hierarchy_tree_.update_rollups();
+            hierarchy_rollups_valid_.store(true, std::memory_order_release);
+        }
     }
-    
-    std::uint32_t total_covered = 0;
-    std::uint32_t total_expected = 0;
-    
-    for (const auto& [name, group] : groups_table) {
-        if (group) {
-            total_covered += group->coverage.covered;
-            total_expected += group->coverage.expected;
+    return hierarchy_tree_;
+}
+
+// Search indexes (prefix, scope, substring and glob queries)
+void CoverageDatabase::invalidate_search_indexes() {
+    group_index_valid_.store(false, std::memory_order_release);
+    instance_index_valid_.store(false, std::memory_order_release);
+    assert_index_valid_.store(false, std::memory_order_release);
+    group_trigrams_valid_.store(false, std::memory_order_release);
+    instance_trigrams_valid_.store(false, std::memory_order_release);
+    assert_trigrams_valid_.store(false, std::memory_order_release);
+}
+
+template <typename Index, typename Table>
+const Index& CoverageDatabase::cached_index(Index& index, std::atomic<bool>& valid, const Table& table) const {
+    if (!valid.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(search_index_mutex_);
+        if (!valid.load(std::memory_order_relaxed)) {
+            index.assign(table);
+            valid.store(true, std::memory_order_release);
         }
     }
-    
-    return (total_expected > 0) ? (100.0 * total_covered / total_expected) : 0.0;
+    return index;
 }
 
-std::vector<CoverageGroup*> CoverageDatabase::get_groups_by_pattern(const std::string& pattern) const {
-    std::vector<CoverageGroup*> result;
+const NameIndex<CoverageGroup>& CoverageDatabase::group_index() const {
+    return cached_index(group_index_, group_index_valid_, groups_table);
+}
+
+const NameIndex<HierarchyInstance>& CoverageDatabase::instance_index() const {
+    return cached_index(instance_index_, instance_index_valid_, hierarchy_table);
+}
+
+const NameIndex<AssertCoverage>& CoverageDatabase::assert_index() const {
+    return cached_index(assert_index_, assert_index_valid_, asserts_table);
+}
+
+std::vector<const CoverageGroup*> CoverageDatabase::get_groups_in_scope(std::string_view scope) const {
+    return const_records(group_index().find_in_scope(scope));
+}
+
+std::vector<HierarchyInstance*> CoverageDatabase::get_instances_in_scope(std::string_view scope) const {
+    return instance_index().find_in_scope(scope);
+}
+
+std::vector<AssertCoverage*> CoverageDatabase::get_asserts_in_scope(std::string_view scope) const {
+    return assert_index().find_in_scope(scope);
+}
+
+const TrigramIndex<CoverageGroup>& CoverageDatabase::group_trigrams() const {
+    return cached_index(group_trigrams_, group_trigrams_valid_, groups_table);
+}
+
+const TrigramIndex<HierarchyInstance>& CoverageDatabase::instance_trigrams() const {
+    return cached_index(instance_trigrams_, instance_trigrams_valid_, hierarchy_table);
+}
+
+const TrigramIndex<AssertCoverage>& CoverageDatabase::assert_trigrams() const {
+    return cached_index(assert_trigrams_, assert_trigrams_valid_, asserts_table);
+}
+
+std::vector<HierarchyInstance*> CoverageDatabase::get_instances_by_pattern(std::string_view pattern) const {
+    return instance_trigrams().find_containing(pattern);
+}
+
+std::vector<AssertCoverage*> CoverageDatabase::get_asserts_by_pattern(std::string_view pattern) const {
+    return assert_trigrams().find_containing(pattern);
+}
+
+std::vector<const CoverageGroup*> CoverageDatabase::get_groups_by_glob(std::string_view glob) const {
+    return const_records(group_trigrams().find_matching(glob));
+}
+
+std::vector<HierarchyInstance*> CoverageDatabase::get_instances_by_glob(std::string_view glob) const {
+    return instance_trigrams().find_matching(glob);
+}
+
+std::vector<AssertCoverage*> CoverageDatabase::get_asserts_by_glob(std::string_view glob) const {
+    return assert_trigrams().find_matching(glob);
+}
+
+void CoverageDatabase::build_search_indexes() const {
+    group_index();
+    instance_index();
+    assert_index();
+    group_trigrams();
+    instance_trigrams();
+    assert_trigrams();
+}
+
+// Columnar group view (aggregates below scan it instead of groups_table)
+
+void GroupColumns::reserve(std::size_t count) {
+    covered.reserve(count);
+    expected.reserve(count);
+    score.reserve(count);
+    weight.reserve(count);
+    goal.reserve(count);
+    groups.reserve(count);
+}
+
+void GroupColumns::push_back(CoverageGroup& group) {
+    covered.push_back(group.coverage.covered);
+    expected.push_back(group.coverage.expected);
+    score.push_back(group.coverage.score);
+    weight.push_back(group.weight);
+    goal.push_back(group.goal);
+    groups.push_back(&group);
+}
+
+void GroupColumns::clear() {
+    covered.clear();
+    expected.clear();
+    score.clear();
+    weight.clear();
+    goal.clear();
+    groups.clear();
+}
+
+const GroupColumns& CoverageDatabase::group_columns() const {
+    if (!group_columns_valid_.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(group_columns_mutex_);
+        if (!group_columns_valid_.load(std::memory_order_relaxed)) {
+            group_columns_.clear();
+            group_columns_.reserve(groups_table.size());
+            for (const auto& [name, group] : groups_table) {
+                if (group) {
+                    group_columns_.push_back(*group);
+                }
+            }
+            group_columns_valid_.store(true, std::memory_order_release);
+        }
+    }
+    return group_columns_;
+}
+
+namespace {
+
+struct ColumnTotals {
+    std::uint64_t covered = 0;
+    std::uint64_t expected = 0;
+};
+
+// Branch-free loop over two contiguous columns: vectorizes
+ColumnTotals sum_columns(const GroupColumns& columns) {
+    ColumnTotals totals;
+    const std::uint32_t* covered = columns.covered.data();
+    const std::uint32_t* expected = columns.expected.data();
+    const std::size_t count = columns.size();
+    for (std::size_t i = 0; i < count; ++i) {
+        totals.covered += covered[i];
+        totals.expected += expected[i];
+    }
+    return totals;
+}
+
+} // anonymous namespace
+
+double CoverageDatabase::calculate_overall_score() const {
+    const ColumnTotals totals = sum_columns(group_columns());
+    return (totals.expected > 0) ? (100.0 * totals.covered / totals.expected) : 0.0;
+}
+
+std::vector<const CoverageGroup*> CoverageDatabase::get_groups_by_pattern(const std::string& pattern) const {
+    return const_records(group_trigrams().find_containing(pattern));
+}
+
+std::vector<const CoverageGroup*> CoverageDatabase::get_uncovered_groups() const {
+    const GroupColumns& columns = group_columns();
+    std::vector<const CoverageGroup*> result;
     
-    for (const auto& [name, group] : groups_table) {
-        if (group && name.find(pattern) != std::string::npos) {
-            result.push_back(group.get());
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+        if (columns.covered[i] == 0) {
+            result.push_back(columns.groups[i]);
         }
     }
     
     return result;
 }
 
-std::vector<CoverageGroup*> CoverageDatabase::get_uncovered_groups() const {
+// The mutable overloads compute their result first and only then discard the
+// columns, which the query itself may have just rebuilt
+std::vector<CoverageGroup*> CoverageDatabase::get_groups_by_pattern(const std::string& pattern) {
+    std::vector<CoverageGroup*> result = group_trigrams().find_containing(pattern);
+    invalidate_group_columns();
+    return result;
+}
+
+std::vector<CoverageGroup*> CoverageDatabase::get_uncovered_groups() {
+    const GroupColumns& columns = group_columns();
     std::vector<CoverageGroup*> result;
     
-    for (const auto& [name, group] : groups_table) {
-        if (group && group->coverage.covered == 0) {
-            result.push_back(group.get());
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+        if (columns.covered[i] == 0) {
+            result.push_back(columns.groups[i]);
         }
     }
     
+    invalidate_group_columns();
+    return result;
+}
+
+std::vector<CoverageGroup*> CoverageDatabase::get_groups_in_scope(std::string_view scope) {
+    std::vector<CoverageGroup*> result = group_index().find_in_scope(scope);
+    invalidate_group_columns();
+    return result;
+}
+
+std::vector<CoverageGroup*> CoverageDatabase::get_groups_by_glob(std::string_view glob) {
+    std::vector<CoverageGroup*> result = group_trigrams().find_matching(glob);
+    invalidate_group_columns();
     return result;
 }
 
 std::unique_ptr<CoverageStatistics> CoverageDatabase::generate_statistics() const {
     auto stats = std::make_unique<CoverageStatistics>();
+    const GroupColumns& columns = group_columns();
     
     // Calculate overall coverage metrics
-    std::uint32_t total_covered = 0;
-    std::uint32_t total_expected = 0;
+    const ColumnTotals totals = sum_columns(columns);
     
-    for (const auto& [name, group] : groups_table) {
-        if (group) {
-            total_covered += group->coverage.covered;
-            total_expected += group->coverage.expected;
-            
-            if (group->coverage.covered == 0) {
-                stats->num_zero_coverage_groups++;
-            } else if (group->coverage.covered == group->coverage.expected) {
-                stats->num_full_coverage_groups++;
-            }
-        }
+    std::uint32_t zero_groups = 0;
+    std::uint32_t full_groups = 0;
+    const std::uint32_t* covered = columns.covered.data();
+    const std::uint32_t* expected = columns.expected.data();
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+        zero_groups += covered[i] == 0;
+        full_groups += (covered[i] != 0) & (covered[i] == expected[i]);
     }
     
-    stats->overall_coverage_score = (total_expected > 0) ? (100.0 * total_covered / total_expected) : 0.0;
-    stats->total_coverage_points = total_expected;
-    stats->covered_points = total_covered;
+    stats->num_zero_coverage_groups = zero_groups;
+    stats->num_full_coverage_groups = full_groups;
+    stats->overall_coverage_score = (totals.expected > 0) ? (100.0 * totals.covered / totals.expected) : 0.0;
+    stats->total_coverage_points = static_cast<std::uint32_t>(totals.expected);
+    stats->covered_points = static_cast<std::uint32_t>(totals.covered);
     
     return stats;
 }
@@ -265,7 +773,7 @@ void HierarchyInstance::extract_module_name() {
     // Find the last component of the path (after the last '.')
     size_t last_dot = instance_path.find_last_of('.');
     if (last_dot != std::string::npos) {
-        module_name = instance_path.substr(last_dot + 1);
+        module_name.assign(instance_path.view().substr(last_dot + 1));
     } else {
         module_name = instance_path; // No dots, entire path is module name
     }
@@ -281,7 +789,7 @@ std::string HierarchyInstance::get_parent_path() const {
 
 std::vector<std::string> HierarchyInstance::get_path_components() const {
     std::vector<std::string> components;
-    std::stringstream ss(instance_path);
+    std::stringstream ss(instance_path.str());
     std::string component;
     
     while (std::getline(ss, component, '.')) {
@@ -0,0 +1,747 @@
+/**
+ * @file coverage_snapshot.cpp
+ * @brief Implementation of the binary snapshot writer and reader
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#include "../include/coverage_snapshot.h"
+#include "../include/high_performance_parser.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace coverage_parser {
+
+// ============================================================================
+// Format Helpers
+// ============================================================================
+
+namespace snapshot {
+
+std::uint64_t name_hash(std::string_view name) {
+    std::uint64_t hash = 0xCBF29CE484222325ULL;
+    for (unsigned char c : name) {
+        hash ^= c;
+        hash *= 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+namespace {
+
+constexpr std::uint64_t PRIME_1 = 0x9E3779B185EBCA87ULL;
+constexpr std::uint64_t PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr std::uint64_t PRIME_3 = 0x165667B19E3779F9ULL;
+
+inline std::uint64_t rotate_left(std::uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+} // anonymous namespace
+
+std::uint64_t checksum(const void* data, std::size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+
+    // Four independent lanes keep several multiplies in flight
+    std::uint64_t lanes[4] = {PRIME_1 + PRIME_2, PRIME_2, 0, 0 - PRIME_1};
+    std::size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        for (int lane = 0; lane < 4; ++lane) {
+            std::uint64_t word;
+            std::memcpy(&word, bytes + i + 8 * lane, sizeof(word));
+            lanes[lane] = rotate_left(lanes[lane] + word * PRIME_2, 31) * PRIME_1;
+        }
+    }
+
+    std::uint64_t hash = rotate_left(lanes[0], 1) + rotate_left(lanes[1], 7) + rotate_left(lanes[2], 12) +
+                         rotate_left(lanes[3], 18) + static_cast<std::uint64_t>(size);
+    for (; i < size; ++i) {
+        hash = rotate_left(hash ^ (bytes[i] * PRIME_3), 11) * PRIME_1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= PRIME_2;
+    hash ^= hash >> 29;
+    hash *= PRIME_3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+} // namespace snapshot
+
+namespace {
+
+using snapshot::SectionKind;
+
+// Name each record kind is indexed by
+const snapshot::Text& record_key(const snapshot::GroupRecord& record) { return record.name; }
+const snapshot::Text& record_key(const snapshot::InstanceRecord& record) { return record.instance_path; }
+const snapshot::Text& record_key(const snapshot::ModuleRecord& record) { return record.module_name; }
+const snapshot::Text& record_key(const snapshot::AssertRecord& record) { return record.assert_name; }
+
+std::size_t record_size(SectionKind kind) {
+    switch (kind) {
+        case SectionKind::DASHBOARD:      return sizeof(snapshot::DashboardRecord);
+        case SectionKind::GROUPS:         return sizeof(snapshot::GroupRecord);
+        case SectionKind::INSTANCES:      return sizeof(snapshot::InstanceRecord);
+        case SectionKind::MODULES:        return sizeof(snapshot::ModuleRecord);
+        case SectionKind::ASSERTS:        return sizeof(snapshot::AssertRecord);
+        case SectionKind::GROUP_INDEX:
+        case SectionKind::INSTANCE_INDEX:
+        case SectionKind::MODULE_INDEX:
+        case SectionKind::ASSERT_INDEX:   return sizeof(snapshot::IndexSlot);
+        default:                          return 1;  // STRINGS: count is in bytes
+    }
+}
+
+std::uint64_t header_checksum(const snapshot::Header& header) {
+    snapshot::Header copy = header;
+    copy.header_checksum = 0;
+    return snapshot::checksum(&copy, sizeof(copy));
+}
+
+snapshot::Metrics to_snapshot(const CoverageMetrics& metrics) {
+    snapshot::Metrics stored{};
+    stored.score = metrics.score;
+    stored.covered = metrics.covered;
+    stored.expected = metrics.expected;
+    stored.is_valid = metrics.is_valid ? 1 : 0;
+    return stored;
+}
+
+CoverageMetrics from_snapshot(const snapshot::Metrics& stored) {
+    CoverageMetrics metrics;
+    metrics.score = stored.score;
+    metrics.covered = stored.covered;
+    metrics.expected = stored.expected;
+    metrics.is_valid = stored.is_valid != 0;
+    return metrics;
+}
+
+/**
+ * @brief STRINGS section under construction; each distinct string is stored once
+ */
+class StringSection {
+public:
+    StringSection() { bytes_.push_back('\0'); }  // Offset 0 is the empty string
+
+    // `text` must stay alive until the section is written
+    snapshot::Text add(std::string_view text) {
+        snapshot::Text stored{};
+        if (text.empty()) {
+            return stored;
+        }
+        auto [it, inserted] = offsets_.try_emplace(text, bytes_.size());
+        if (inserted) {
+            bytes_.append(text.data(), text.size());
+            bytes_.push_back('\0');
+        }
+        stored.offset = it->second;
+        stored.length = static_cast<std::uint32_t>(text.size());
+        return stored;
+    }
+
+    const std::string& bytes() const { return bytes_; }
+
+private:
+    std::string bytes_;
+    FlatHashMap<std::string_view, std::uint64_t> offsets_;
+};
+
+// Open-addressing index over the records' names, at most half full
+template <typename T>
+std::vector<snapshot::IndexSlot> build_index(const std::vector<T>& records, const StringSection& strings) {
+    std::size_t capacity = 0;
+    if (!records.empty()) {
+        capacity = 1;
+        while (capacity < 2 * records.size()) {
+            capacity *= 2;
+        }
+    }
+    std::vector<snapshot::IndexSlot> slots(capacity, snapshot::IndexSlot{snapshot::EMPTY_SLOT, 0});
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        const snapshot::Text& key = record_key(records[i]);
+        const std::uint64_t hash = snapshot::name_hash(std::string_view(strings.bytes().data() + key.offset, key.length));
+        std::size_t slot = static_cast<std::size_t>(hash) & (capacity - 1);
+        while (slots[slot].record != snapshot::EMPTY_SLOT) {
+            slot = (slot + 1) & (capacity - 1);
+        }
+        slots[slot] = snapshot::IndexSlot{static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(hash)};
+    }
+    return slots;
+}
+
+struct SectionData {
+    const void* data;
+    std::size_t size;
+    std::size_t count;
+};
+
+template <typename T>
+SectionData section_of(const std::vector<T>& items) {
+    return SectionData{items.data(), items.size() * sizeof(T), items.size()};
+}
+
+// Records of a validated section, read in place
+template <typename T>
+snapshot::RecordSpan<T> section_span(const char* base, const snapshot::Section& section) {
+    return snapshot::RecordSpan<T>(reinterpret_cast<const T*>(base + section.offset), static_cast<std::size_t>(section.count));
+}
+
+constexpr std::size_t align_up(std::size_t offset) { return (offset + 7) & ~static_cast<std::size_t>(7); }
+
+} // anonymous namespace
+
+// ============================================================================
+// Snapshot Writer
+// ============================================================================
+
+ParserResult write_snapshot(const CoverageDatabase& db, const std::string& filename) {
+    constexpr std::size_t MAX_RECORDS = std::numeric_limits<std::uint32_t>::max();
+    if (db.get_num_groups() >= MAX_RECORDS || db.get_num_hierarchy_instances() >= MAX_RECORDS ||
+        db.get_num_modules() >= MAX_RECORDS || db.get_num_asserts() >= MAX_RECORDS) {
+        return ParserResult::ERROR_INVALID_PARAMETER;
+    }
+
+    try {
+        StringSection strings;
+
+        std::vector<snapshot::DashboardRecord> dashboard;
+        if (db.dashboard_data) {
+            const DashboardData& source = *db.dashboard_data;
+            snapshot::DashboardRecord record{};
+            record.date = strings.add(source.date);
+            record.user = strings.add(source.user);
+            record.version = strings.add(source.version);
+            record.command_line = strings.add(source.command_line);
+            record.total_score = source.total_score;
+            record.assert_coverage = to_snapshot(source.assert_coverage);
+            record.group_coverage = to_snapshot(source.group_coverage);
+            record.generation_time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                source.generation_time.time_since_epoch()).count();
+            record.num_hierarchical_instances = source.num_hierarchical_instances;
+            dashboard.push_back(record);
+        }
+
+        std::vector<snapshot::GroupRecord> groups;
+        groups.reserve(db.get_num_groups());
+        for (const auto& [name, group] : db.groups_table) {
+            if (!group) {
+                continue;
+            }
+            const CoverageGroup& source = *group;
+            snapshot::GroupRecord record{};
+            record.name = strings.add(name);
+            record.comment = strings.add(source.comment);
+            record.coverage = to_snapshot(source.coverage);
+            record.instance_coverage = to_snapshot(source.instance_coverage);
+            record.instances = source.instances;
+            record.weight = source.weight;
+            record.goal = source.goal;
+            record.at_least = source.at_least;
+            record.per_instance = source.per_instance;
+            record.auto_bin_max = source.auto_bin_max;
+            record.print_missing = source.print_missing;
+            record.is_auto_generated = source.is_auto_generated ? 1 : 0;
+            groups.push_back(record);
+        }
+
+        // Instances go out in HierarchyTree node order, not hash order: node IDs
+        // follow first mention in the report, so reloading rebuilds the same
+        // tree with children in the same order. Records the tree does not hold
+        // (written to hierarchy_table directly) follow in table order.
+        std::vector<std::pair<std::string_view, const HierarchyInstance*>> ordered_instances;
+        ordered_instances.reserve(db.get_num_hierarchy_instances());
+        const HierarchyTree& tree = db.hierarchy_tree();
+        auto in_tree = [&tree](std::string_view path, const HierarchyInstance* instance) {
+            const HierarchyTree::NodeId node = tree.find(path);
+            return node != HierarchyTree::INVALID_NODE && tree.instance(node) == instance;
+        };
+        for (HierarchyTree::NodeId node = 0; node < tree.size(); ++node) {
+            const HierarchyInstance* instance = tree.instance(node);
+            auto it = instance ? db.hierarchy_table.find(tree.path(node)) : db.hierarchy_table.end();
+            if (it != db.hierarchy_table.end() && it->second.get() == instance) {
+                ordered_instances.emplace_back(it->first, instance);
+            }
+        }
+        if (ordered_instances.size() < db.get_num_hierarchy_instances()) {
+            for (const auto& [name, instance] : db.hierarchy_table) {
+                if (instance && !in_tree(name, instance.get())) {
+                    ordered_instances.emplace_back(name, instance.get());
+                }
+            }
+        }
+
+        std::vector<snapshot::InstanceRecord> instances;
+        instances.reserve(ordered_instances.size());
+        for (const auto& [name, instance] : ordered_instances) {
+            const HierarchyInstance& source = *instance;
+            snapshot::InstanceRecord record{};
+            record.instance_path = strings.add(name);
+            record.module_name = strings.add(source.module_name);
+            record.total_score = source.total_score;
+            record.assert_coverage = to_snapshot(source.assert_coverage);
+            record.group_coverage = to_snapshot(source.group_coverage);
+            record.depth_level = source.depth_level;
+            record.is_leaf_instance = source.is_leaf_instance ? 1 : 0;
+            instances.push_back(record);
+        }
+
+        std::vector<snapshot::ModuleRecord> modules;
+        modules.reserve(db.get_num_modules());
+        for (const auto& [name, module] : db.modules_table) {
+            if (!module) {
+                continue;
+            }
+            const ModuleDefinition& source = *module;
+            snapshot::ModuleRecord record{};
+            record.module_name = strings.add(name);
+            record.total_score = source.total_score;
+            record.assert_coverage = to_snapshot(source.assert_coverage);
+            record.group_coverage = to_snapshot(source.group_coverage);
+            record.instance_count = source.instance_count;
+            record.covered_instances = source.covered_instances;
+            modules.push_back(record);
+        }
+
+        std::vector<snapshot::AssertRecord> asserts;
+        asserts.reserve(db.get_num_asserts());
+        for (const auto& [name, assert_cov] : db.asserts_table) {
+            if (!assert_cov) {
+                continue;
+            }
+            const AssertCoverage& source = *assert_cov;
+            snapshot::AssertRecord record{};
+            record.assert_name = strings.add(name);
+            record.instance_path = strings.add(source.instance_path);
+            record.file_location = strings.add(source.file_location);
+            record.severity = strings.add(source.severity);
+            record.message = strings.add(source.message);
+            record.line_number = source.line_number;
+            record.is_covered = source.is_covered ? 1 : 0;
+            record.hit_count = source.hit_count;
+            asserts.push_back(record);
+        }
+
+        const std::vector<snapshot::IndexSlot> group_index = build_index(groups, strings);
+        const std::vector<snapshot::IndexSlot> instance_index = build_index(instances, strings);
+        const std::vector<snapshot::IndexSlot> module_index = build_index(modules, strings);
+        const std::vector<snapshot::IndexSlot> assert_index = build_index(asserts, strings);
+
+        // In SectionKind order
+        const SectionData sections[snapshot::SECTION_COUNT] = {
+            section_of(dashboard),
+            section_of(groups),
+            section_of(group_index),
+            section_of(instances),
+            section_of(instance_index),
+            section_of(modules),
+            section_of(module_index),
+            section_of(asserts),
+            section_of(assert_index),
+            SectionData{strings.bytes().data(), strings.bytes().size(), strings.bytes().size()},
+        };
+
+        snapshot::Header header{};
+        std::memcpy(header.magic, snapshot::MAGIC, sizeof(header.magic));
+        header.version = snapshot::FORMAT_VERSION;
+        header.byte_order = snapshot::BYTE_ORDER_MARK;
+        header.flags = db.is_valid ? snapshot::FLAG_DATABASE_VALID : 0;
+        header.section_count = snapshot::SECTION_COUNT;
+        std::size_t offset = sizeof(header);
+        for (std::uint32_t i = 0; i < snapshot::SECTION_COUNT; ++i) {
+            offset = align_up(offset);
+            snapshot::Section& section = header.sections[i];
+            section.kind = i;
+            section.offset = offset;
+            section.size = sections[i].size;
+            section.count = sections[i].count;
+            section.checksum = snapshot::checksum(sections[i].data, sections[i].size);
+            offset += sections[i].size;
+        }
+        header.file_size = offset;
+        header.header_checksum = header_checksum(header);
+
+        std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            return ParserResult::ERROR_FILE_NOT_FOUND;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        std::size_t written = sizeof(header);
+        const char padding[8] = {};
+        for (std::uint32_t i = 0; i < snapshot::SECTION_COUNT; ++i) {
+            file.write(padding, static_cast<std::streamsize>(header.sections[i].offset - written));
+            file.write(static_cast<const char*>(sections[i].data), static_cast<std::streamsize>(sections[i].size));
+            written = header.sections[i].offset + sections[i].size;
+        }
+        file.close();
+        return file ? ParserResult::SUCCESS : ParserResult::ERROR_FILE_NOT_FOUND;
+
+    } catch (const std::bad_alloc&) {
+        return ParserResult::ERROR_MEMORY_ALLOCATION;
+    }
+}
+
+// ============================================================================
+// Snapshot Reader
+// ============================================================================
+
+SnapshotReader::SnapshotReader() = default;
+SnapshotReader::~SnapshotReader() = default;
+SnapshotReader::SnapshotReader(SnapshotReader&&) noexcept = default;
+SnapshotReader& SnapshotReader::operator=(SnapshotReader&&) noexcept = default;
+
+ParserResult SnapshotReader::open(const std::string& filename, bool verify) {
+    close();
+
+    // Lookups jump around the file: no read-ahead of the whole mapping
+    auto file = std::make_unique<performance::MemoryMappedFile>(filename, performance::MemoryMappedFile::Access::RANDOM);
+    if (!file->is_valid()) {
+        return ParserResult::ERROR_FILE_NOT_FOUND;
+    }
+    if (file->size() < sizeof(snapshot::Header)) {
+        return ParserResult::ERROR_INVALID_FORMAT;
+    }
+
+    const auto* header = reinterpret_cast<const snapshot::Header*>(file->data());
+    if (std::memcmp(header->magic, snapshot::MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != snapshot::FORMAT_VERSION || header->byte_order != snapshot::BYTE_ORDER_MARK ||
+        header->file_size != file->size() || header->section_count != snapshot::SECTION_COUNT ||
+        header->header_checksum != header_checksum(*header)) {
+        return ParserResult::ERROR_INVALID_FORMAT;
+    }
+
+    for (std::uint32_t i = 0; i < snapshot::SECTION_COUNT; ++i) {
+        const snapshot::Section& section = header->sections[i];
+        const std::size_t unit = record_size(static_cast<SectionKind>(i));
+        if (section.kind != i || section.offset % 8 != 0 || section.offset > file->size() ||
+            section.size > file->size() - section.offset || section.size % unit != 0 || section.count != section.size / unit) {
+            return ParserResult::ERROR_INVALID_FORMAT;
+        }
+    }
+
+    const char* base = file->data();
+    const snapshot::Section* sections = header->sections;
+    const snapshot::Section& dashboard = sections[static_cast<std::uint32_t>(SectionKind::DASHBOARD)];
+    dashboard_ = dashboard.count > 0 ? reinterpret_cast<const snapshot::DashboardRecord*>(base + dashboard.offset) : nullptr;
+    groups_ = section_span<snapshot::GroupRecord>(base, sections[static_cast<std::uint32_t>(SectionKind::GROUPS)]);
+    instances_ = section_span<snapshot::InstanceRecord>(base, sections[static_cast<std::uint32_t>(SectionKind::INSTANCES)]);
+    modules_ = section_span<snapshot::ModuleRecord>(base, sections[static_cast<std::uint32_t>(SectionKind::MODULES)]);
+    asserts_ = section_span<snapshot::AssertRecord>(base, sections[static_cast<std::uint32_t>(SectionKind::ASSERTS)]);
+    group_index_ = section_span<snapshot::IndexSlot>(base, sections[static_cast<std::uint32_t>(SectionKind::GROUP_INDEX)]);
+    instance_index_ = section_span<snapshot::IndexSlot>(base, sections[static_cast<std::uint32_t>(SectionKind::INSTANCE_INDEX)]);
+    module_index_ = section_span<snapshot::IndexSlot>(base, sections[static_cast<std::uint32_t>(SectionKind::MODULE_INDEX)]);
+    assert_index_ = section_span<snapshot::IndexSlot>(base, sections[static_cast<std::uint32_t>(SectionKind::ASSERT_INDEX)]);
+    const snapshot::Section& strings = sections[static_cast<std::uint32_t>(SectionKind::STRINGS)];
+    strings_ = std::string_view(base + strings.offset, static_cast<std::size_t>(strings.size));
+
+    // Probing masks with the capacity, which must be a power of two
+    for (auto index : {group_index_, instance_index_, module_index_, assert_index_}) {
+        if ((index.size() & (index.size() - 1)) != 0) {
+            return ParserResult::ERROR_INVALID_FORMAT;
+        }
+    }
+
+    header_ = header;
+    file_ = std::move(file);
+
+    if (verify) {
+        ParserResult result = verify_checksums();
+        if (result != ParserResult::SUCCESS) {
+            close();
+            return result;
+        }
+    }
+    return ParserResult::SUCCESS;
+}
+
+void SnapshotReader::close() {
+    header_ = nullptr;
+    dashboard_ = nullptr;
+    groups_ = {};
+    instances_ = {};
+    modules_ = {};
+    asserts_ = {};
+    group_index_ = {};
+    instance_index_ = {};
+    module_index_ = {};
+    assert_index_ = {};
+    strings_ = {};
+    file_.reset();
+}
+
+ParserResult SnapshotReader::verify_checksums() const {
+    if (!header_) {
+        return ParserResult::ERROR_INVALID_PARAMETER;
+    }
+    for (const snapshot::Section& section : header_->sections) {
+        if (snapshot::checksum(file_->data() + section.offset, static_cast<std::size_t>(section.size)) != section.checksum) {
+            return ParserResult::ERROR_INVALID_FORMAT;
+        }
+    }
+    return ParserResult::SUCCESS;
+}
+
+const snapshot::DashboardRecord* SnapshotReader::dashboard() const {
+    return dashboard_;
+}
+
+std::string_view SnapshotReader::text(const snapshot::Text& text) const {
+    if (text.offset > strings_.size() || text.length > strings_.size() - text.offset) {
+        return {};
+    }
+    return strings_.substr(static_cast<std::size_t>(text.offset), text.length);
+}
+
+template <typename T>
+const T* SnapshotReader::find_record(snapshot::RecordSpan<T> records, snapshot::RecordSpan<snapshot::IndexSlot> index,
+                                     std::string_view name) const {
+    if (index.empty()) {
+        return nullptr;
+    }
+    const std::uint64_t hash = snapshot::name_hash(name);
+    const std::size_t mask = index.size() - 1;
+    for (std::size_t probe = 0, slot = static_cast<std::size_t>(hash) & mask; probe < index.size();
+         ++probe, slot = (slot + 1) & mask) {
+        const snapshot::IndexSlot& entry = index[slot];
+        if (entry.record == snapshot::EMPTY_SLOT) {
+            return nullptr;
+        }
+        if (entry.hash_tag == static_cast<std::uint32_t>(hash) && entry.record < records.size() &&
+            text(record_key(records[entry.record])) == name) {
+            return &records[entry.record];
+        }
+    }
+    return nullptr;
+}
+
+const snapshot::GroupRecord* SnapshotReader::find_group(std::string_view name) const {
+    return find_record(groups_, group_index_, name);
+}
+
+const snapshot::InstanceRecord* SnapshotReader::find_instance(std::string_view path) const {
+    return find_record(instances_, instance_index_, path);
+}
+
+const snapshot::ModuleRecord* SnapshotReader::find_module(std::string_view name) const {
+    return find_record(modules_, module_index_, name);
+}
+
+const snapshot::AssertRecord* SnapshotReader::find_assert(std::string_view name) const {
+    return find_record(asserts_, assert_index_, name);
+}
+
+// ============================================================================
+// Database Loading
+// ============================================================================
+
+namespace {
+
+// Interns each stored string once: STRINGS holds every distinct string
+// once, so its offset identifies it, and an integer lookup replaces hashing
+// and locking in the interner for every repeated path, file and severity
+class StoredStrings {
+public:
+    StoredStrings(const SnapshotReader& reader, CoverageDatabase& db) : reader_(reader), db_(db) {}
+
+    RecordString intern(const snapshot::Text& text) {
+        auto [it, inserted] = interned_.try_emplace(text.offset);
+        if (inserted) {
+            it->second = db_.intern(reader_.text(text));
+        }
+        return RecordString::external(it->second.data(), it->second.size());
+    }
+
+private:
+    const SnapshotReader&                         reader_;
+    CoverageDatabase&                             db_;
+    FlatHashMap<std::uint64_t, std::string_view>  interned_;
+};
+
+// Tree nodes that adding the stored instances creates: each path adds its
+// own node and every ancestor neither in the tree nor added before it
+std::size_t new_tree_nodes(const SnapshotReader& reader, const HierarchyTree& tree) {
+    FlatHashMap<std::string_view, bool> added;
+    for (const snapshot::InstanceRecord& stored : reader.instances()) {
+        std::string_view path = reader.text(stored.instance_path);
+        while (tree.find(path) == HierarchyTree::INVALID_NODE && added.try_emplace(path, true).second) {
+            const std::size_t last_dot = path.rfind('.');
+            if (last_dot == std::string_view::npos) {
+                break;
+            }
+            path = path.substr(0, last_dot);
+        }
+    }
+    return added.size();
+}
+
+// Records of a snapshot, created in the target database but not yet added
+struct StagedSnapshot {
+    std::unique_ptr<DashboardData>                 dashboard;
+    std::vector<RecordPtr<CoverageGroup>>          groups;
+    std::vector<RecordPtr<HierarchyInstance>>      instances;
+    std::vector<RecordPtr<ModuleDefinition>>       modules;
+    std::vector<RecordPtr<AssertCoverage>>         asserts;
+};
+
+// Create one record per stored record. May throw; `db`'s tables are not
+// touched, only its storage and interned strings grow.
+void stage_snapshot(const SnapshotReader& reader, CoverageDatabase& db, StagedSnapshot& staged) {
+    staged.groups.reserve(reader.groups().size());
+    staged.instances.reserve(reader.instances().size());
+    staged.modules.reserve(reader.modules().size());
+    staged.asserts.reserve(reader.asserts().size());
+
+    if (const snapshot::DashboardRecord* stored = reader.dashboard()) {
+        auto dashboard = std::make_unique<DashboardData>();
+        dashboard->date = std::string(reader.text(stored->date));
+        dashboard->user = std::string(reader.text(stored->user));
+        dashboard->version = std::string(reader.text(stored->version));
+        dashboard->command_line = std::string(reader.text(stored->command_line));
+        dashboard->total_score = stored->total_score;
+        dashboard->assert_coverage = from_snapshot(stored->assert_coverage);
+        dashboard->group_coverage = from_snapshot(stored->group_coverage);
+        dashboard->num_hierarchical_instances = stored->num_hierarchical_instances;
+        dashboard->generation_time = std::chrono::system_clock::time_point(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                std::chrono::nanoseconds(stored->generation_time_ns)));
+        staged.dashboard = std::move(dashboard);
+    }
+
+    // Names and paths repeat across records: intern them, as the parsers do
+    StoredStrings strings(reader, db);
+    for (const snapshot::GroupRecord& stored : reader.groups()) {
+        auto group = db.create_coverage_group();
+        group->name = strings.intern(stored.name);
+        group->comment = db.make_string(reader.text(stored.comment));
+        group->coverage = from_snapshot(stored.coverage);
+        group->instance_coverage = from_snapshot(stored.instance_coverage);
+        group->instances = stored.instances;
+        group->weight = stored.weight;
+        group->goal = stored.goal;
+        group->at_least = stored.at_least;
+        group->per_instance = stored.per_instance;
+        group->auto_bin_max = stored.auto_bin_max;
+        group->print_missing = stored.print_missing;
+        group->is_auto_generated = stored.is_auto_generated != 0;
+        staged.groups.push_back(std::move(group));
+    }
+
+    for (const snapshot::InstanceRecord& stored : reader.instances()) {
+        auto instance = db.create_hierarchy_instance();
+        instance->instance_path = strings.intern(stored.instance_path);
+        instance->module_name = strings.intern(stored.module_name);
+        instance->total_score = stored.total_score;
+        instance->assert_coverage = from_snapshot(stored.assert_coverage);
+        instance->group_coverage = from_snapshot(stored.group_coverage);
+        instance->depth_level = stored.depth_level;
+        instance->is_leaf_instance = stored.is_leaf_instance != 0;
+        staged.instances.push_back(std::move(instance));
+    }
+
+    for (const snapshot::ModuleRecord& stored : reader.modules()) {
+        auto module = db.create_module_definition();
+        module->module_name = strings.intern(stored.module_name);
+        module->total_score = stored.total_score;
+        module->assert_coverage = from_snapshot(stored.assert_coverage);
+        module->group_coverage = from_snapshot(stored.group_coverage);
+        module->instance_count = stored.instance_count;
+        module->covered_instances = stored.covered_instances;
+        staged.modules.push_back(std::move(module));
+    }
+
+    for (const snapshot::AssertRecord& stored : reader.asserts()) {
+        auto assert_cov = db.create_assert_coverage();
+        assert_cov->assert_name = strings.intern(stored.assert_name);
+        assert_cov->instance_path = strings.intern(stored.instance_path);
+        assert_cov->file_location = strings.intern(stored.file_location);
+        assert_cov->severity = strings.intern(stored.severity);
+        assert_cov->message = db.make_string(reader.text(stored.message));
+        assert_cov->line_number = stored.line_number;
+        assert_cov->is_covered = stored.is_covered != 0;
+        assert_cov->hit_count = stored.hit_count;
+        staged.asserts.push_back(std::move(assert_cov));
+    }
+}
+
+// Add the staged records to `db`, replacing same-named ones. The tables and
+// the hierarchy tree are sized first, so only the reserve calls may throw:
+// `db` either gains every record or none.
+void commit_snapshot(const SnapshotReader& reader, StagedSnapshot& staged, CoverageDatabase& db) {
+    db.reserve_coverage_groups(db.get_num_groups() + staged.groups.size());
+    db.reserve_hierarchy_instances(db.get_num_hierarchy_instances() + staged.instances.size());
+    db.reserve_module_definitions(db.get_num_modules() + staged.modules.size());
+    db.reserve_assert_coverage(db.get_num_asserts() + staged.asserts.size());
+    if (!staged.instances.empty()) {
+        const HierarchyTree& tree = db.hierarchy_tree();
+        db.reserve_hierarchy_nodes(tree.size() + new_tree_nodes(reader, tree));
+    }
+
+    // Keys are already interned and every insert fits the reserved space
+    if (staged.dashboard) {
+        db.dashboard_data = std::move(staged.dashboard);
+    }
+    for (RecordPtr<CoverageGroup>& group : staged.groups) {
+        db.add_coverage_group(std::move(group));
+    }
+    for (RecordPtr<HierarchyInstance>& instance : staged.instances) {
+        db.add_hierarchy_instance(std::move(instance));
+    }
+    for (RecordPtr<ModuleDefinition>& module : staged.modules) {
+        db.add_module_definition(std::move(module));
+    }
+    for (RecordPtr<AssertCoverage>& assert_cov : staged.asserts) {
+        db.add_assert_coverage(std::move(assert_cov));
+    }
+}
+
+} // anonymous namespace
+
+ParserResult load_snapshot(const std::string& filename, CoverageDatabase& db) {
+    SnapshotReader reader;
+    ParserResult result = reader.open(filename, true);
+    if (result != ParserResult::SUCCESS) {
+        return result;
+    }
+
+    try {
+        db.reset();
+        StagedSnapshot staged;
+        stage_snapshot(reader, db, staged);
+        commit_snapshot(reader, staged, db);
+        db.is_valid = reader.database_valid();
+        return ParserResult::SUCCESS;
+
+    } catch (const std::bad_alloc&) {
+        db.reset();
+        return ParserResult::ERROR_MEMORY_ALLOCATION;
+    }
+}
+
+ParserResult merge_snapshot(const std::string& filename, CoverageDatabase& db) {
+    SnapshotReader reader;
+    ParserResult result = reader.open(filename, true);
+    if (result != ParserResult::SUCCESS) {
+        return result;
+    }
+
+    try {
+        StagedSnapshot staged;
+        stage_snapshot(reader, db, staged);
+        commit_snapshot(reader, staged, db);
+        db.is_valid = db.is_valid || reader.database_valid();
+        return ParserResult::SUCCESS;
+
+    } catch (const std::bad_alloc&) {
+        // Staged records are released on the way out; no table was touched
+        return ParserResult::ERROR_MEMORY_ALLOCATION;
+    }
+}
+
+} // namespace coverage_parser
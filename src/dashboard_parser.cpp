@@ -100,8 +100,9 @@
  */
 
 #include "functional_coverage_parser.h"
+#include "compressed_input.h"
+#include "line_classifier.h"
 #include <sstream>
-#include <regex>
 #include <iomanip>
 #include <algorithm>
 
@@ -118,7 +119,7 @@ namespace coverage_parser {
  * @return ParserResult indicating success or failure
  */
 ParserResult DashboardParser::parse(const std::string& filename, CoverageDatabase& db) {
-    std::ifstream file(filename);
+    ReportStream file(filename);
     if (!file.is_open()) {
         return ParserResult::ERROR_FILE_NOT_FOUND;
     }
@@ -149,6 +150,11 @@ ParserResult DashboardParser::parse(const std::string& filename, CoverageDatabas
         // Ignore parsing errors for now
     }
     
+    // A corrupt or truncated compressed report
+    if (file.bad()) {
+        return ParserResult::ERROR_INVALID_FORMAT;
+    }
+    
     // Store parsed data in database (basic data even if parsing was partial)
     db.dashboard_data = std::move(dashboard_data);
     db.is_valid = true;
@@ -169,7 +175,7 @@ ParserResult DashboardParser::parse(const std::string& filename, CoverageDatabas
  * @param dashboard Dashboard data structure to populate
  * @return ParserResult indicating success or failure
  */
-ParserResult DashboardParser::parse_header_section(std::ifstream& file, DashboardData& dashboard) {
+ParserResult DashboardParser::parse_header_section(std::istream& file, DashboardData& dashboard) {
     std::string line;
     bool found_dashboard_title = false;
     
@@ -260,7 +266,7 @@ ParserResult DashboardParser::parse_header_section(std::ifstream& file, Dashboar
  * @param dashboard Dashboard data structure to populate
  * @return ParserResult indicating success or failure
  */
-ParserResult DashboardParser::parse_coverage_summary(std::ifstream& file, DashboardData& dashboard) {
+ParserResult DashboardParser::parse_coverage_summary(std::istream& file, DashboardData& dashboard) {
     std::string line;
     bool found_summary_section = false;
     
@@ -281,48 +287,36 @@ ParserResult DashboardParser::parse_coverage_summary(std::ifstream& file, Dashbo
     
     // Parse the actual data line
     if (std::getline(file, line)) {
-        std::istringstream iss(line);
-        std::string token;
-        std::vector<std::string> tokens;
-        
         // Split by whitespace
-        while (iss >> token) {
-            tokens.push_back(token);
-        }
+        tokenizer::FieldBuffer<5> tokens;
+        tokenizer::split_fields(line, tokens);
         
         if (tokens.size() >= 4) {
-            try {
-                // Parse total score
-                dashboard.total_score = std::stod(tokens[0]);
-                
-                // Parse ASSERT coverage: "22.11 60148/272087"
-                dashboard.assert_coverage.score = std::stod(tokens[1]);
-                
-                // Parse assert coverage numbers from format "60148/272087"
-                std::string assert_fraction = tokens[2];
-                size_t slash_pos = assert_fraction.find('/');
-                if (slash_pos != std::string::npos) {
-                    dashboard.assert_coverage.covered = std::stoul(assert_fraction.substr(0, slash_pos));
-                    dashboard.assert_coverage.expected = std::stoul(assert_fraction.substr(slash_pos + 1));
-                    dashboard.assert_coverage.is_valid = true;
-                }
-                
-                // Parse GROUP coverage: "41.01 134908/328987"
-                dashboard.group_coverage.score = std::stod(tokens[3]);
-                
-                if (tokens.size() >= 5) {
-                    std::string group_fraction = tokens[4];
-                    slash_pos = group_fraction.find('/');
-                    if (slash_pos != std::string::npos) {
-                        dashboard.group_coverage.covered = std::stoul(group_fraction.substr(0, slash_pos));
-                        dashboard.group_coverage.expected = std::stoul(group_fraction.substr(slash_pos + 1));
-                        dashboard.group_coverage.is_valid = true;
-                    }
+            // Parse total score and ASSERT coverage: "22.11 60148/272087"
+            if (!utils::try_parse_double(tokens[0], dashboard.total_score) ||
+                !utils::try_parse_double(tokens[1], dashboard.assert_coverage.score)) {
+                return ParserResult::ERROR_PARSE_FAILED;
+            }
+            
+            // Parse assert coverage numbers from format "60148/272087"
+            if (tokens[2].find('/') != std::string_view::npos) {
+                if (!utils::try_parse_fraction(tokens[2], dashboard.assert_coverage.covered, dashboard.assert_coverage.expected)) {
+                    return ParserResult::ERROR_PARSE_FAILED;
                 }
-                
-            } catch (const std::exception& e) {
+                dashboard.assert_coverage.is_valid = true;
+            }
+            
+            // Parse GROUP coverage: "41.01 134908/328987"
+            if (!utils::try_parse_double(tokens[3], dashboard.group_coverage.score)) {
                 return ParserResult::ERROR_PARSE_FAILED;
             }
+            
+            if (tokens.size() >= 5 && tokens[4].find('/') != std::string_view::npos) {
+                if (!utils::try_parse_fraction(tokens[4], dashboard.group_coverage.covered, dashboard.group_coverage.expected)) {
+                    return ParserResult::ERROR_PARSE_FAILED;
+                }
+                dashboard.group_coverage.is_valid = true;
+            }
         }
     }
     
@@ -340,7 +334,7 @@ ParserResult DashboardParser::parse_coverage_summary(std::ifstream& file, Dashbo
  * @param dashboard Dashboard data structure to populate
  * @return ParserResult indicating success or failure
  */
-ParserResult DashboardParser::parse_hierarchical_instances(std::ifstream& file, DashboardData& dashboard) {
+ParserResult DashboardParser::parse_hierarchical_instances(std::istream& file, DashboardData& dashboard) {
     std::string line;
     bool found_hierarchy_section = false;
     std::uint32_t instance_count = 0;
@@ -414,8 +408,7 @@ bool DashboardParser::is_header_line(const std::string& line) const {
  */
 bool DashboardParser::is_coverage_summary_line(const std::string& line) const {
     // Look for pattern: number(s) followed by instance path
-    std::regex coverage_pattern(R"(\s*\d+\.\d+\s+\d+\.\d+\s+\d+/\d+.*\w+)");
-    return std::regex_match(line, coverage_pattern);
+    return line_classifier::is_dashboard_instance_line(line);
 }
 
 } // namespace coverage_parser
\ No newline at end of file
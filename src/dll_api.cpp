@@ -13,6 +13,10 @@
 
 #include "functional_coverage_parser.h"
 #include "high_performance_parser.h"
+#include "functional_coverage_parser_dll.h"
+#include "parse_cache.h"
+#include "record_stream.h"
+#include "thread_pool.h"
 #include <memory>
 #include <map>
 
@@ -24,9 +28,156 @@ static std::map<void*, std::unique_ptr<HighPerformanceGroupsParser>> hp_groups_p
 static std::map<void*, std::unique_ptr<HighPerformanceHierarchyParser>> hp_hierarchy_parsers;
 static std::map<void*, std::unique_ptr<HighPerformanceAssertParser>> hp_assert_parsers;
 static std::map<void*, std::unique_ptr<HighPerformanceDashboardParser>> hp_dashboard_parsers;
+static std::map<void*, std::unique_ptr<HighPerformanceModuleListParser>> hp_modlist_parsers;
 static std::map<void*, std::unique_ptr<CoverageDatabase>> database_handles;
 static uint32_t next_handle_id = 1;
 
+// Set by set_parse_cache_directory(); parse_coverage_file() bypasses it while null
+static std::unique_ptr<ParseCache> parse_cache;
+
+/**
+ * @brief Copy high-performance parser statistics into the C API structure
+ */
+static void copy_performance_stats(const HighPerformanceGroupsParser::PerformanceStats& parser_stats, PerformanceStats* stats) {
+    stats->parse_time_seconds = parser_stats.parse_time_seconds;
+    stats->file_size_bytes = static_cast<uint32_t>(parser_stats.file_size_bytes);
+    stats->lines_processed = static_cast<uint32_t>(parser_stats.lines_processed);
+    stats->groups_parsed = static_cast<uint32_t>(parser_stats.groups_parsed);
+    stats->memory_allocated = static_cast<uint32_t>(parser_stats.memory_allocated);
+    stats->threads_used = parser_stats.threads_used;
+    stats->throughput_mb_per_sec = parser_stats.throughput_mb_per_sec;
+}
+
+/**
+ * @brief Copy a record's score and counts into the C API structure
+ */
+static void copy_record_metrics(double score, const CoverageMetrics& coverage, RecordMetrics* metrics) {
+    if (metrics) {
+        metrics->score = score;
+        metrics->covered = coverage.covered;
+        metrics->expected = coverage.expected;
+        metrics->hit_count = 0;
+    }
+}
+
+/**
+ * @brief Resolve a database handle and run a by-name lookup on it
+ * @return 1 if @p find found the record, 0 if not, -1 on invalid arguments
+ */
+template <typename Find>
+static int find_record(void* db_handle, const char* key, Find find) {
+    if (!db_handle || !key) {
+        return -1;
+    }
+    
+    auto db_it = database_handles.find(db_handle);
+    if (db_it == database_handles.end()) {
+        return -1;
+    }
+    
+    return find(*db_it->second, std::string_view(key)) ? 1 : 0;
+}
+
+/**
+ * @brief Run @p parser on @p filename, through the parse cache when one is set
+ * @param variant Cache variant naming the parser kind
+ */
+template <typename Parser>
+static int run_parser(Parser& parser, const char* variant, const char* filename, CoverageDatabase& db) {
+    if (!parse_cache) {
+        return static_cast<int>(parser.parse(filename, db));
+    }
+    return static_cast<int>(parse_cache->parse(filename, variant, db,
+        [&parser](const std::string& file, CoverageDatabase& target) { return parser.parse(file, target); }));
+}
+
+/**
+ * @brief Resolve a parser handle of any kind
+ * @return nullptr if @p handle is not a parser handle
+ */
+static BaseParser* find_parser(void* handle) {
+    auto groups_it = hp_groups_parsers.find(handle);
+    if (groups_it != hp_groups_parsers.end()) {
+        return groups_it->second.get();
+    }
+    auto hierarchy_it = hp_hierarchy_parsers.find(handle);
+    if (hierarchy_it != hp_hierarchy_parsers.end()) {
+        return hierarchy_it->second.get();
+    }
+    auto assert_it = hp_assert_parsers.find(handle);
+    if (assert_it != hp_assert_parsers.end()) {
+        return assert_it->second.get();
+    }
+    auto dashboard_it = hp_dashboard_parsers.find(handle);
+    if (dashboard_it != hp_dashboard_parsers.end()) {
+        return dashboard_it->second.get();
+    }
+    auto modlist_it = hp_modlist_parsers.find(handle);
+    if (modlist_it != hp_modlist_parsers.end()) {
+        return modlist_it->second.get();
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Record visitor that forwards each record to a C callback
+ */
+class CallbackVisitor : public RecordVisitor {
+public:
+    CallbackVisitor(RecordCallback callback, void* user_data)
+        : callback_(callback), user_data_(user_data) {}
+    
+    bool on_group(const GroupRecord& group) override {
+        StreamedRecord record = start(RECORD_GROUP, group.name);
+        copy_record_metrics(group.coverage.score, group.coverage, &record.metrics);
+        return deliver(record);
+    }
+    
+    bool on_instance(const HierarchyRecord& instance) override {
+        StreamedRecord record = start(RECORD_HIERARCHY_INSTANCE, instance.instance_path);
+        record.module_name = text(instance.module_name);
+        record.depth_level = instance.depth_level;
+        copy_record_metrics(instance.total_score, instance.assert_coverage, &record.metrics);
+        return deliver(record);
+    }
+    
+    bool on_module(const ModuleRecord& module) override {
+        StreamedRecord record = start(RECORD_MODULE, module.module_name);
+        copy_record_metrics(module.total_score, module.assert_coverage, &record.metrics);
+        return deliver(record);
+    }
+    
+    bool on_assert(const AssertRecord& assert_cov) override {
+        StreamedRecord record = start(RECORD_ASSERT, assert_cov.assert_name);
+        record.instance_path = text(assert_cov.instance_path);
+        record.file_location = text(assert_cov.file_location);
+        record.severity = text(assert_cov.severity);
+        record.line_number = assert_cov.line_number;
+        record.metrics.score = assert_cov.is_covered ? 100.0 : 0.0;
+        record.metrics.covered = assert_cov.is_covered ? 1 : 0;
+        record.metrics.expected = 1;
+        record.metrics.hit_count = assert_cov.hit_count;
+        return deliver(record);
+    }
+    
+private:
+    static RecordText text(std::string_view view) {
+        return RecordText{view.data(), static_cast<uint32_t>(view.size())};
+    }
+    
+    static StreamedRecord start(StreamRecordKind kind, std::string_view name) {
+        StreamedRecord record{};
+        record.kind = kind;
+        record.name = text(name);
+        return record;
+    }
+    
+    bool deliver(const StreamedRecord& record) { return callback_(&record, user_data_) != 0; }
+    
+    RecordCallback callback_;
+    void*          user_data_;
+};
+
 extern "C" {
 
 /**
@@ -50,8 +201,8 @@ COVERAGE_PARSER_API const char* get_library_info() {
  * @param result Parser result code
  * @return Error description string
  */
-COVERAGE_PARSER_API const char* get_error_string(ParserResult result) {
-    switch (result) {
+COVERAGE_PARSER_API const char* get_error_string(int result) {
+    switch (static_cast<ParserResult>(result)) {
         case ParserResult::SUCCESS:
             return "Success";
         case ParserResult::ERROR_FILE_NOT_FOUND:
@@ -84,6 +235,21 @@ COVERAGE_PARSER_API void* create_coverage_database() {
     }
 }
 
+/**
+ * @brief Create coverage database with arena record storage
+ * @return Database handle or nullptr on failure
+ */
+COVERAGE_PARSER_API void* create_arena_coverage_database() {
+    try {
+        auto db = std::make_unique<CoverageDatabase>(StorageMode::ARENA);
+        void* handle = reinterpret_cast<void*>(next_handle_id++);
+        database_handles[handle] = std::move(db);
+        return handle;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
 /**
  * @brief Destroy coverage database
  * @param handle Database handle
@@ -109,6 +275,21 @@ COVERAGE_PARSER_API void* create_dashboard_parser() {
     }
 }
 
+/**
+ * @brief Create module list parser (high-performance optimized)
+ * @return Parser handle or nullptr on failure
+ */
+COVERAGE_PARSER_API void* create_modlist_parser() {
+    try {
+        auto parser = std::make_unique<HighPerformanceModuleListParser>();
+        void* handle = reinterpret_cast<void*>(next_handle_id++);
+        hp_modlist_parsers[handle] = std::move(parser);
+        return handle;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
 /**
  * @brief Create groups parser (high-performance optimized)
  * @return Parser handle or nullptr on failure
@@ -166,6 +347,7 @@ COVERAGE_PARSER_API void destroy_parser(void* handle) {
     hp_hierarchy_parsers.erase(handle);
     hp_assert_parsers.erase(handle);
     hp_dashboard_parsers.erase(handle);
+    hp_modlist_parsers.erase(handle);
 }
 
 /**
@@ -189,29 +371,31 @@ COVERAGE_PARSER_API int parse_coverage_file(void* parser_handle, const char* fil
         // Try groups parser first
         auto groups_it = hp_groups_parsers.find(parser_handle);
         if (groups_it != hp_groups_parsers.end()) {
-            ParserResult result = groups_it->second->parse(filename, *db_it->second);
-            return static_cast<int>(result);
+            return run_parser(*groups_it->second, "groups", filename, *db_it->second);
         }
         
         // Try hierarchy parser
         auto hierarchy_it = hp_hierarchy_parsers.find(parser_handle);
         if (hierarchy_it != hp_hierarchy_parsers.end()) {
-            ParserResult result = hierarchy_it->second->parse(filename, *db_it->second);
-            return static_cast<int>(result);
+            return run_parser(*hierarchy_it->second, "hierarchy", filename, *db_it->second);
         }
         
         // Try assert parser
         auto assert_it = hp_assert_parsers.find(parser_handle);
         if (assert_it != hp_assert_parsers.end()) {
-            ParserResult result = assert_it->second->parse(filename, *db_it->second);
-            return static_cast<int>(result);
+            return run_parser(*assert_it->second, "assert", filename, *db_it->second);
         }
         
         // Try dashboard parser
         auto dashboard_it = hp_dashboard_parsers.find(parser_handle);
         if (dashboard_it != hp_dashboard_parsers.end()) {
-            ParserResult result = dashboard_it->second->parse(filename, *db_it->second);
-            return static_cast<int>(result);
+            return run_parser(*dashboard_it->second, "dashboard", filename, *db_it->second);
+        }
+        
+        // Try module list parser
+        auto modlist_it = hp_modlist_parsers.find(parser_handle);
+        if (modlist_it != hp_modlist_parsers.end()) {
+            return run_parser(*modlist_it->second, "modlist", filename, *db_it->second);
         }
         
         return static_cast<int>(ParserResult::ERROR_INVALID_PARAMETER);
@@ -353,6 +537,91 @@ COVERAGE_PARSER_API int get_num_asserts(void* db_handle) {
     }
 }
 
+/**
+ * @brief Look up a coverage group by full name
+ * @return 1 if found, 0 if not found, -1 on error
+ */
+COVERAGE_PARSER_API int find_coverage_group(void* db_handle, const char* name, RecordMetrics* metrics) {
+    return find_record(db_handle, name, [metrics](const CoverageDatabase& db, std::string_view key) {
+        const CoverageGroup* group = db.find_coverage_group(key);
+        if (group) {
+            copy_record_metrics(group->coverage.score, group->coverage, metrics);
+        }
+        return group != nullptr;
+    });
+}
+
+/**
+ * @brief Look up a hierarchy instance by full path
+ * @return 1 if found, 0 if not found, -1 on error
+ */
+COVERAGE_PARSER_API int find_hierarchy_instance(void* db_handle, const char* path, RecordMetrics* metrics) {
+    return find_record(db_handle, path, [metrics](const CoverageDatabase& db, std::string_view key) {
+        const HierarchyInstance* instance = db.find_hierarchy_instance(key);
+        if (instance) {
+            copy_record_metrics(instance->total_score, instance->assert_coverage, metrics);
+        }
+        return instance != nullptr;
+    });
+}
+
+/**
+ * @brief Look up a module definition by name
+ * @return 1 if found, 0 if not found, -1 on error
+ */
+COVERAGE_PARSER_API int find_module_definition(void* db_handle, const char* name, RecordMetrics* metrics) {
+    return find_record(db_handle, name, [metrics](const CoverageDatabase& db, std::string_view key) {
+        const ModuleDefinition* module = db.find_module_definition(key);
+        if (module) {
+            copy_record_metrics(module->total_score, module->assert_coverage, metrics);
+        }
+        return module != nullptr;
+    });
+}
+
+/**
+ * @brief Look up an assertion by name
+ * @return 1 if found, 0 if not found, -1 on error
+ */
+COVERAGE_PARSER_API int find_assert_coverage(void* db_handle, const char* name, RecordMetrics* metrics) {
+    return find_record(db_handle, name, [metrics](const CoverageDatabase& db, std::string_view key) {
+        const AssertCoverage* assert_cov = db.find_assert_coverage(key);
+        if (assert_cov && metrics) {
+            metrics->score = assert_cov->is_covered ? 100.0 : 0.0;
+            metrics->covered = assert_cov->is_covered ? 1 : 0;
+            metrics->expected = 1;
+            metrics->hit_count = assert_cov->hit_count;
+        }
+        return assert_cov != nullptr;
+    });
+}
+
+/**
+ * @brief Stream a coverage file's records to a callback
+ * @param parser_handle Parser handle selecting the file format
+ * @param filename File to read
+ * @param callback Receives each record
+ * @param user_data Passed through to @p callback
+ * @return Parser result code
+ */
+COVERAGE_PARSER_API int stream_coverage_file(void* parser_handle, const char* filename, RecordCallback callback, void* user_data) {
+    if (!parser_handle || !filename || !callback) {
+        return static_cast<int>(ParserResult::ERROR_INVALID_PARAMETER);
+    }
+    
+    BaseParser* parser = find_parser(parser_handle);
+    if (!parser) {
+        return static_cast<int>(ParserResult::ERROR_INVALID_PARAMETER);
+    }
+    
+    try {
+        CallbackVisitor visitor(callback, user_data);
+        return static_cast<int>(parser->stream(filename, visitor));
+    } catch (...) {
+        return static_cast<int>(ParserResult::ERROR_PARSE_FAILED);
+    }
+}
+
 /**
  * @brief Export coverage to XML
  * @param db_handle Database handle
@@ -407,8 +676,13 @@ COVERAGE_PARSER_API void cleanup_library() {
     hp_hierarchy_parsers.clear();
     hp_assert_parsers.clear();
     hp_dashboard_parsers.clear();
+    hp_modlist_parsers.clear();
     database_handles.clear();
     next_handle_id = 1;
+    parse_cache.reset();
+    
+    // Join the worker threads now rather than during static destruction
+    ThreadPool::reset_shared();
 }
 
 /**
@@ -457,42 +731,35 @@ COVERAGE_PARSER_API int get_performance_stats(void* parser_handle, PerformanceSt
         // Try groups parser first
         auto groups_it = hp_groups_parsers.find(parser_handle);
         if (groups_it != hp_groups_parsers.end()) {
-            const auto& parser_stats = groups_it->second->get_stats();
-            stats->parse_time_seconds = parser_stats.parse_time_seconds;
-            stats->file_size_bytes = parser_stats.file_size_bytes;
-            stats->lines_processed = parser_stats.lines_processed;
-            stats->groups_parsed = parser_stats.groups_parsed;
-            stats->memory_allocated = parser_stats.memory_allocated;
-            stats->threads_used = parser_stats.threads_used;
-            stats->throughput_mb_per_sec = parser_stats.throughput_mb_per_sec;
+            copy_performance_stats(groups_it->second->get_stats(), stats);
             return static_cast<int>(ParserResult::SUCCESS);
         }
         
         // Try hierarchy parser
         auto hierarchy_it = hp_hierarchy_parsers.find(parser_handle);
         if (hierarchy_it != hp_hierarchy_parsers.end()) {
-            const auto& parser_stats = hierarchy_it->second->get_stats();
-            stats->parse_time_seconds = parser_stats.parse_time_seconds;
-            stats->file_size_bytes = parser_stats.file_size_bytes;
-            stats->lines_processed = parser_stats.lines_processed;
-            stats->groups_parsed = parser_stats.groups_parsed;
-            stats->memory_allocated = parser_stats.memory_allocated;
-            stats->threads_used = parser_stats.threads_used;
-            stats->throughput_mb_per_sec = parser_stats.throughput_mb_per_sec;
+            copy_performance_stats(hierarchy_it->second->get_stats(), stats);
             return static_cast<int>(ParserResult::SUCCESS);
         }
         
         // Try assert parser
         auto assert_it = hp_assert_parsers.find(parser_handle);
         if (assert_it != hp_assert_parsers.end()) {
-            const auto& parser_stats = assert_it->second->get_stats();
-            stats->parse_time_seconds = parser_stats.parse_time_seconds;
-            stats->file_size_bytes = parser_stats.file_size_bytes;
-            stats->lines_processed = parser_stats.lines_processed;
-            stats->groups_parsed = parser_stats.groups_parsed;
-            stats->memory_allocated = parser_stats.memory_allocated;
-            stats->threads_used = parser_stats.threads_used;
-            stats->throughput_mb_per_sec = parser_stats.throughput_mb_per_sec;
+            copy_performance_stats(assert_it->second->get_stats(), stats);
+            return static_cast<int>(ParserResult::SUCCESS);
+        }
+        
+        // Try dashboard parser
+        auto dashboard_it = hp_dashboard_parsers.find(parser_handle);
+        if (dashboard_it != hp_dashboard_parsers.end()) {
+            copy_performance_stats(dashboard_it->second->get_stats(), stats);
+            return static_cast<int>(ParserResult::SUCCESS);
+        }
+        
+        // Try module list parser
+        auto modlist_it = hp_modlist_parsers.find(parser_handle);
+        if (modlist_it != hp_modlist_parsers.end()) {
+            copy_performance_stats(modlist_it->second->get_stats(), stats);
             return static_cast<int>(ParserResult::SUCCESS);
         }
         
@@ -506,7 +773,7 @@ COVERAGE_PARSER_API int get_performance_stats(void* parser_handle, PerformanceSt
 /**
  * @brief Auto-select optimal parser (always high-performance)
  * @param filename Path to coverage file to analyze
- * @param parser_type "groups", "hierarchy", "assert", "dashboard"
+ * @param parser_type "groups", "hierarchy", "assert", "dashboard", "modlist"
  * @return Parser handle or nullptr on error
  */
 COVERAGE_PARSER_API void* create_optimal_parser(const char* filename, const char* parser_type) {
@@ -534,6 +801,10 @@ COVERAGE_PARSER_API void* create_optimal_parser(const char* filename, const char
             auto parser = std::make_unique<HighPerformanceDashboardParser>();
             hp_dashboard_parsers[handle] = std::move(parser);
             return handle;
+        } else if (type == "modlist") {
+            auto parser = std::make_unique<HighPerformanceModuleListParser>();
+            hp_modlist_parsers[handle] = std::move(parser);
+            return handle;
         }
         
         return nullptr;
@@ -543,4 +814,51 @@ COVERAGE_PARSER_API void* create_optimal_parser(const char* filename, const char
     }
 }
 
+// Upper bound for set_thread_pool_size(), guards against garbage arguments
+static const uint32_t MAX_THREAD_POOL_SIZE = 1024;
+
+/**
+ * @brief Set the worker count of the shared thread pool
+ * @param num_threads Worker count, 0 for one per hardware thread
+ * @return Parser result code
+ */
+COVERAGE_PARSER_API int set_thread_pool_size(uint32_t num_threads) {
+    if (num_threads > MAX_THREAD_POOL_SIZE) {
+        return static_cast<int>(ParserResult::ERROR_INVALID_PARAMETER);
+    }
+    
+    try {
+        ThreadPool::set_shared_size(num_threads);
+        return static_cast<int>(ParserResult::SUCCESS);
+    } catch (...) {
+        return static_cast<int>(ParserResult::ERROR_PARSE_FAILED);
+    }
+}
+
+/**
+ * @brief Get the worker count of the shared thread pool
+ * @return Number of worker threads
+ */
+COVERAGE_PARSER_API uint32_t get_thread_pool_size() {
+    return static_cast<uint32_t>(ThreadPool::shared_size());
+}
+
+/**
+ * @brief Enable or disable the parse cache
+ * @param directory Cache directory, NULL or empty to disable
+ * @return Parser result code
+ */
+COVERAGE_PARSER_API int set_parse_cache_directory(const char* directory) {
+    try {
+        if (!directory || !*directory) {
+            parse_cache.reset();
+        } else {
+            parse_cache = std::make_unique<ParseCache>(directory);
+        }
+        return static_cast<int>(ParserResult::SUCCESS);
+    } catch (...) {
+        return static_cast<int>(ParserResult::ERROR_MEMORY_ALLOCATION);
+    }
+}
+
 } // extern "C"
\ No newline at end of file
@@ -33,8 +33,7 @@
  */
 
 #include "functional_coverage_parser.h"
-#include <sstream>
-#include <regex>
+#include "record_stream.h"
 #include <algorithm>
 
 namespace coverage_parser {
@@ -42,224 +41,89 @@ namespace coverage_parser {
 /**
  * @brief Parse a hierarchy coverage file
  * 
- * Main entry point for parsing hierarchy.txt files. Processes the header
- * section and then parses individual hierarchy instance entries.
+ * Main entry point for parsing hierarchy.txt files. Reads the instance
+ * entries with a RecordReader and stores each one that passes the
+ * configured filters in the database.
  * 
  * @param filename Path to the hierarchy file
  * @param db Database to populate with parsed data
  * @return ParserResult indicating success or failure
  */
 ParserResult HierarchyParser::parse(const std::string& filename, CoverageDatabase& db) {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        return ParserResult::ERROR_FILE_NOT_FOUND;
+    RecordReader reader(filename, ReportKind::HIERARCHY, config_);
+    if (reader.status() != ParserResult::SUCCESS) {
+        return reader.status();
     }
     
-    std::string line;
-    std::uint32_t instances_parsed = 0;
-    std::uint32_t parse_errors = 0;
-    bool found_data_section = false;
-    
-    // Skip header and find data section
-    while (std::getline(file, line)) {
-        if (line.find("SCORE") != std::string::npos && 
-            line.find("ASSERT") != std::string::npos) {
-            found_data_section = true;
-            break;
-        }
-    }
-    
-    if (!found_data_section) {
-        return ParserResult::ERROR_INVALID_FORMAT;
+    // The header declares no total: pre-size from the file size, best effort
+    try {
+        db.reserve_hierarchy_instances(db.get_num_hierarchy_instances() + utils::expected_record_count(
+            0, report_content_size(filename), utils::TYPICAL_HIERARCHY_LINE_BYTES, config_.max_instances));
+    } catch (const std::bad_alloc&) {
     }
     
-    // Parse individual hierarchy entries
-    while (std::getline(file, line)) {
-        // Skip empty lines and separators
-        if (line.empty() || line.find("---") != std::string::npos) {
-            continue;
-        }
-        
-        // Skip header lines
-        if (is_header_line(line)) {
-            continue;
-        }
-        
-        // Parse hierarchy data line
-        if (is_hierarchy_data_line(line)) {
-            ParserResult result = parse_hierarchy_entry(line, db);
-            if (result == ParserResult::SUCCESS) {
-                instances_parsed++;
-            } else {
-                parse_errors++;
-                
-                // If too many parse errors, fail
-                if (parse_errors > 20) {
-                    return ParserResult::ERROR_PARSE_FAILED;
-                }
-            }
-            
-            // Check if we've reached the configured maximum
-            if (config_.max_instances > 0 && instances_parsed >= config_.max_instances) {
-                break;
-            }
-        }
+    while (reader.next()) {
+        const HierarchyRecord& record = reader.instance();
+        auto instance = db.create_hierarchy_instance();
+        instance->instance_path = db.intern(record.instance_path);
+        instance->module_name = db.intern(record.module_name);
+        instance->total_score = record.total_score;
+        instance->assert_coverage = record.assert_coverage;
+        instance->depth_level = record.depth_level;
+        instance->is_leaf_instance = record.is_leaf_instance;
+        db.add_hierarchy_instance(std::move(instance));
     }
     
-    return ParserResult::SUCCESS;
+    return reader.status();
 }
 
 /**
- * @brief Parse a single hierarchy entry line
- * 
- * Parses a line containing hierarchy instance data and creates a HierarchyInstance
- * object to store in the database.
+ * @brief Stream the instance entries of a hierarchy file to a visitor
  * 
- * Expected format:
- * SCORE ASSERT_SCORE ASSERT_COVERED/ASSERT_EXPECTED INSTANCE_PATH
- * 
- * @param line Line containing hierarchy data
- * @param db Database to store the parsed instance
+ * @param filename Path to the hierarchy file
+ * @param visitor Receives each instance, through on_instance()
  * @return ParserResult indicating success or failure
  */
-ParserResult HierarchyParser::parse_hierarchy_entry(const std::string& line, CoverageDatabase& db) {
-    try {
-        std::vector<std::string> tokens = split_hierarchy_line(line);
-        
-        // Need at least 4 fields for a valid hierarchy entry
-        if (tokens.size() < 4) {
-            return ParserResult::ERROR_INVALID_FORMAT;
-        }
-        
-        auto instance = std::make_unique<HierarchyInstance>();
-        
-        // Parse coverage scores
-        instance->total_score = std::stod(tokens[0]);
-        instance->assert_coverage.score = std::stod(tokens[1]);
-        
-        // Parse assert coverage fraction (format: "covered/expected")
-        std::string assert_fraction = tokens[2];
-        size_t slash_pos = assert_fraction.find('/');
-        if (slash_pos != std::string::npos) {
-            instance->assert_coverage.covered = std::stoul(assert_fraction.substr(0, slash_pos));
-            instance->assert_coverage.expected = std::stoul(assert_fraction.substr(slash_pos + 1));
-            instance->assert_coverage.is_valid = true;
-        }
-        
-        // Extract instance path (remaining tokens)
-        std::string instance_path;
-        for (size_t i = 3; i < tokens.size(); ++i) {
-            if (i > 3) instance_path += " ";
-            instance_path += tokens[i];
-        }
-        instance->instance_path = instance_path;
-        
-        // Calculate hierarchy depth and extract module name
-        instance->depth_level = calculate_depth_level(instance->instance_path);
-        instance->extract_module_name();
-        
-        // Determine if this is a leaf instance (heuristic based on path structure)
-        instance->is_leaf_instance = (instance->instance_path.find(".mem_") != std::string::npos ||
-                                      instance->instance_path.find(".PDP") != std::string::npos ||
-                                      instance->instance_path.find("_0") != std::string::npos ||
-                                      instance->instance_path.find("_1") != std::string::npos);
-        
-        // Skip instances below coverage threshold if configured
-        if (instance->total_score < config_.min_coverage_threshold) {
-            return ParserResult::SUCCESS;
-        }
-        
-        // Add to database
-        db.add_hierarchy_instance(std::move(instance));
-        
-        return ParserResult::SUCCESS;
-        
-    } catch (const std::exception& e) {
-        return ParserResult::ERROR_PARSE_FAILED;
-    }
+ParserResult HierarchyParser::stream(const std::string& filename, RecordVisitor& visitor) {
+    return stream_report(filename, ReportKind::HIERARCHY, visitor, config_);
 }
 
 /**
- * @brief Check if a line contains hierarchy data
- * 
- * Determines if the given line contains numerical hierarchy instance data
- * rather than headers, separators, or comments.
- * 
- * @param line Line to check
- * @return true if line contains hierarchy data, false otherwise
- */
-bool HierarchyParser::is_hierarchy_data_line(const std::string& line) const {
-    // Skip obvious non-data lines
-    if (line.empty() || line[0] == '-' || line.find("SCORE") != std::string::npos) {
-        return false;
-    }
-    
-    // Look for pattern: starts with decimal numbers followed by instance path
-    std::regex data_pattern(R"(\s*\d+\.\d+\s+\d+\.\d+\s+\d+/\d+\s+.+)");
-    return std::regex_match(line, data_pattern);
-}
-
-/**
- * @brief Check if a line is a header line
+ * @brief Calculate hierarchy depth level from instance path
  * 
- * Determines if the given line is a header/title line in the hierarchy file.
+ * Determines the depth level in the design hierarchy by counting
+ * the number of dots ('.') in the instance path.
  * 
- * @param line Line to check
- * @return true if line is a header, false otherwise
+ * @param instance_path Full hierarchical instance path
+ * @return Depth level (0 = top level, 1 = first level down, etc.)
  */
-bool HierarchyParser::is_header_line(const std::string& line) const {
-    return line.find("Design Hierarchy") != std::string::npos ||
-           line.find("SCORE") != std::string::npos ||
-           line.find("ASSERT") != std::string::npos ||
-           line.find("Hierarchical") != std::string::npos;
+std::uint32_t HierarchyParser::calculate_depth_level(std::string_view instance_path) const {
+    return static_cast<std::uint32_t>(std::count(instance_path.begin(), instance_path.end(), '.'));
 }
 
 /**
- * @brief Split a hierarchy line into tokens
+ * @brief Derive path-based attributes of a parsed instance
  * 
- * Splits a hierarchy instance data line into individual fields, handling
- * various whitespace and formatting issues.
+ * Fills in the hierarchy depth, the module name (last path component) and
+ * the leaf flag from the instance path. Shared with the high-performance
+ * hierarchy parser so both produce identical instances.
  * 
- * @param line Line to split
- * @return Vector of tokens
+ * @param instance Instance whose instance_path has already been set
+ * @param db Database that interns the module name
  */
-std::vector<std::string> HierarchyParser::split_hierarchy_line(const std::string& line) const {
-    std::vector<std::string> tokens;
-    std::istringstream iss(line);
-    std::string token;
-    
-    // The first three tokens are numeric fields
-    for (int i = 0; i < 3 && iss >> token; ++i) {
-        tokens.push_back(token);
-    }
-    
-    // The rest is the instance path (may contain spaces in some formats)
-    std::string remaining_line;
-    std::getline(iss, remaining_line);
+void HierarchyParser::classify_instance(HierarchyInstance& instance, CoverageDatabase& db) const {
+    std::string_view path = instance.instance_path;
+    instance.depth_level = calculate_depth_level(path);
     
-    if (!remaining_line.empty()) {
-        // Trim leading whitespace
-        remaining_line.erase(0, remaining_line.find_first_not_of(" \t"));
-        
-        if (!remaining_line.empty()) {
-            tokens.push_back(remaining_line);
-        }
-    }
+    // Module name is the last path component (the whole path at top level)
+    size_t last_dot = path.find_last_of('.');
+    instance.module_name = db.intern(last_dot != std::string_view::npos ? path.substr(last_dot + 1) : path);
     
-    return tokens;
-}
-
-/**
- * @brief Calculate hierarchy depth level from instance path
- * 
- * Determines the depth level in the design hierarchy by counting
- * the number of dots ('.') in the instance path.
- * 
- * @param instance_path Full hierarchical instance path
- * @return Depth level (0 = top level, 1 = first level down, etc.)
- */
-std::uint32_t HierarchyParser::calculate_depth_level(const std::string& instance_path) const {
-    return static_cast<std::uint32_t>(std::count(instance_path.begin(), instance_path.end(), '.'));
+    // Determine if this is a leaf instance (heuristic based on path structure)
+    instance.is_leaf_instance = (instance.instance_path.find(".mem_") != std::string::npos ||
+                                 instance.instance_path.find(".PDP") != std::string::npos ||
+                                 instance.instance_path.find("_0") != std::string::npos ||
+                                 instance.instance_path.find("_1") != std::string::npos);
 }
 
 } // namespace coverage_parser
\ No newline at end of file
@@ -0,0 +1,138 @@
+/**
+ * @file hierarchy_tree.cpp
+ * @brief Implementation of the hierarchy tree index
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#include "hierarchy_tree.h"
+#include "coverage_types.h"
+
+namespace coverage_parser {
+
+// ============================================================================
+// SubtreeCoverage Implementation
+// ============================================================================
+
+SubtreeCoverage& SubtreeCoverage::operator+=(const SubtreeCoverage& other) {
+    assert_covered += other.assert_covered;
+    assert_expected += other.assert_expected;
+    group_covered += other.group_covered;
+    group_expected += other.group_expected;
+    instances += other.instances;
+    return *this;
+}
+
+// ============================================================================
+// Tree Construction
+// ============================================================================
+
+HierarchyTree::NodeId HierarchyTree::insert(std::string_view path, const HierarchyInstance* instance) {
+    NodeId node = ensure_node(path);
+    instance_[node] = instance;
+    return node;
+}
+
+HierarchyTree::NodeId HierarchyTree::ensure_node(std::string_view path) {
+    auto it = index_.find(path);
+    if (it != index_.end()) {
+        return it->second;
+    }
+
+    // Ancestors first, so every parent ID is smaller than its children's
+    std::size_t last_dot = path.rfind('.');
+    NodeId parent = last_dot == std::string_view::npos ? INVALID_NODE : ensure_node(path.substr(0, last_dot));
+
+    const NodeId node = static_cast<NodeId>(parent_.size());
+    parent_.push_back(parent);
+    first_child_.push_back(INVALID_NODE);
+    last_child_.push_back(INVALID_NODE);
+    next_sibling_.push_back(INVALID_NODE);
+    depth_.push_back(parent == INVALID_NODE ? 0 : depth_[parent] + 1);
+    path_.push_back(path);
+    instance_.push_back(nullptr);
+    subtree_.emplace_back();
+    index_[path] = node;
+
+    NodeId& first = parent == INVALID_NODE ? first_root_ : first_child_[parent];
+    NodeId& last = parent == INVALID_NODE ? last_root_ : last_child_[parent];
+    if (last == INVALID_NODE) {
+        first = node;
+    } else {
+        next_sibling_[last] = node;
+    }
+    last = node;
+
+    return node;
+}
+
+void HierarchyTree::update_rollups() {
+    // Own totals first, then fold each node into its parent; children have
+    // larger IDs than their parents, so a reverse pass sees complete subtrees
+    for (NodeId node = 0; node < size(); ++node) {
+        SubtreeCoverage& totals = subtree_[node];
+        totals = SubtreeCoverage{};
+        if (const HierarchyInstance* instance = instance_[node]) {
+            totals.assert_covered = instance->assert_coverage.covered;
+            totals.assert_expected = instance->assert_coverage.expected;
+            totals.group_covered = instance->group_coverage.covered;
+            totals.group_expected = instance->group_coverage.expected;
+            totals.instances = 1;
+        }
+    }
+    for (NodeId node = static_cast<NodeId>(size()); node-- > 0;) {
+        if (parent_[node] != INVALID_NODE) {
+            subtree_[parent_[node]] += subtree_[node];
+        }
+    }
+}
+
+void HierarchyTree::reserve(std::size_t nodes) {
+    parent_.reserve(nodes);
+    first_child_.reserve(nodes);
+    last_child_.reserve(nodes);
+    next_sibling_.reserve(nodes);
+    depth_.reserve(nodes);
+    path_.reserve(nodes);
+    instance_.reserve(nodes);
+    subtree_.reserve(nodes);
+    index_.reserve(nodes);
+}
+
+void HierarchyTree::clear() {
+    parent_.clear();
+    first_child_.clear();
+    last_child_.clear();
+    next_sibling_.clear();
+    depth_.clear();
+    path_.clear();
+    instance_.clear();
+    subtree_.clear();
+    index_.clear();
+    first_root_ = INVALID_NODE;
+    last_root_ = INVALID_NODE;
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+HierarchyTree::NodeId HierarchyTree::find(std::string_view path) const {
+    auto it = index_.find(path);
+    return it != index_.end() ? it->second : INVALID_NODE;
+}
+
+std::string_view HierarchyTree::name(NodeId node) const {
+    std::string_view full = path_[node];
+    std::size_t last_dot = full.rfind('.');
+    return last_dot == std::string_view::npos ? full : full.substr(last_dot + 1);
+}
+
+SubtreeCoverage HierarchyTree::subtree_coverage(std::string_view path) const {
+    NodeId node = find(path);
+    return node != INVALID_NODE ? subtree_[node] : SubtreeCoverage{};
+}
+
+} // namespace coverage_parser
@@ -21,12 +21,36 @@
  */
 
 #include "high_performance_parser.h"
+#include "compressed_input.h"
+#include "line_classifier.h"
+#include "thread_pool.h"
+#ifdef _WIN32
 #include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <atomic>
 #include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
 #include <algorithm>
 #include <execution>
-#include <future>
+#include <tuple>
+#include <cstring>
+
+#if COVERAGE_PARSER_X86
 #include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
 
 namespace coverage_parser {
 namespace performance {
@@ -35,7 +59,8 @@ namespace performance {
 // Memory-Mapped File Implementation
 // ============================================================================
 
-MemoryMappedFile::MemoryMappedFile(const std::string& filename) {
+MemoryMappedFile::MemoryMappedFile(const std::string& filename, Access access) {
+#ifdef _WIN32
     // Open file handle
     file_handle_ = CreateFileA(
         filename.c_str(),
@@ -43,11 +68,12 @@ MemoryMappedFile::MemoryMappedFile(const std::string& filename) {
         FILE_SHARE_READ,
         nullptr,
         OPEN_EXISTING,
-        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+        FILE_ATTRIBUTE_NORMAL | (access == Access::SEQUENTIAL ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_FLAG_RANDOM_ACCESS),
         nullptr
     );
     
     if (file_handle_ == INVALID_HANDLE_VALUE) {
+        file_handle_ = nullptr;
         return;
     }
     
@@ -79,6 +105,7 @@ MemoryMappedFile::MemoryMappedFile(const std::string& filename) {
     if (mapping_handle_ == nullptr) {
         CloseHandle(file_handle_);
         file_handle_ = nullptr;
+        size_ = 0;
         return;
     }
     
@@ -96,10 +123,63 @@ MemoryMappedFile::MemoryMappedFile(const std::string& filename) {
         mapping_handle_ = nullptr;
         file_handle_ = nullptr;
         size_ = 0;
+        return;
+    }
+#else
+    // Open file descriptor
+    int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return;
+    }
+    
+    // Get file size
+    struct stat file_info;
+    if (::fstat(fd, &file_info) != 0 || !S_ISREG(file_info.st_mode) || file_info.st_size <= 0) {
+        ::close(fd);
+        return;
+    }
+    
+    size_ = static_cast<std::size_t>(file_info.st_size);
+    
+    // Map entire file read-only
+    void* mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    
+    // The mapping keeps its own reference to the file, so the descriptor
+    // is no longer needed once mmap() has returned
+    ::close(fd);
+    
+    if (mapping == MAP_FAILED) {
+        size_ = 0;
+        return;
+    }
+    
+    // Parsers scan the mapping front to back exactly once: ask the kernel for
+    // aggressive read-ahead and to start paging the file in immediately.
+    // madvise() advice values are not bit flags, so they are applied separately.
+    // Random access only pages in what is touched.
+    if (access == Access::SEQUENTIAL) {
+        ::madvise(mapping, size_, MADV_SEQUENTIAL);
+        ::madvise(mapping, size_, MADV_WILLNEED);
+    } else {
+        ::madvise(mapping, size_, MADV_RANDOM);
+    }
+    
+    data_ = static_cast<const char*>(mapping);
+#endif
+    
+    if (access == Access::SEQUENTIAL) {
+        decompress_contents();
     }
 }
 
 MemoryMappedFile::~MemoryMappedFile() {
+    if (!decompressed_) {
+        unmap();
+    }
+}
+
+void MemoryMappedFile::unmap() {
+#ifdef _WIN32
     if (data_) {
         UnmapViewOfFile(data_);
     }
@@ -109,6 +189,33 @@ MemoryMappedFile::~MemoryMappedFile() {
     if (file_handle_) {
         CloseHandle(file_handle_);
     }
+    mapping_handle_ = nullptr;
+    file_handle_ = nullptr;
+#else
+    if (data_) {
+        ::munmap(const_cast<char*>(data_), size_);
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+}
+
+void MemoryMappedFile::decompress_contents() {
+    const Compression compression = detect_compression(data_, size_);
+    if (compression == Compression::NONE) {
+        return;
+    }
+    
+    // Parsers only ever see text: the compressed mapping is dropped either way
+    std::unique_ptr<char[]> contents;
+    std::size_t contents_size = 0;
+    const bool decompressed = decompress_buffer(data_, size_, compression, contents, contents_size);
+    unmap();
+    if (decompressed && contents_size > 0) {
+        decompressed_ = std::move(contents);
+        data_ = decompressed_.get();
+        size_ = contents_size;
+    }
 }
 
 std::string_view MemoryMappedFile::get_view(std::size_t offset, std::size_t length) const {
@@ -121,222 +228,583 @@ std::string_view MemoryMappedFile::get_view(std::size_t offset, std::size_t leng
 // ============================================================================
 // SIMD String Operations
 // ============================================================================
+//
+// Every kernel comes in scalar, SSE2, AVX2 and AVX-512BW flavours. The widest
+// flavour supported by the CPU and the OS is bound once, while the library is
+// loaded, and the public simd:: functions call straight through that table.
+// AVX2 and AVX-512 code is compiled with per-function target attributes, so
+// the rest of the library keeps the baseline instruction set.
 
 namespace simd {
 
-const char* find_char_simd(const char* data, std::size_t length, char target) {
+namespace {
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define COVERAGE_SIMD_TARGET(isa)
+#else
+#define COVERAGE_SIMD_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+// Index of the lowest set bit; mask must be non-zero
+inline unsigned lowest_bit(std::uint32_t mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+
+inline bool is_skipped_whitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// Record the newline positions flagged in a 32-bit comparison mask
+inline void append_positions(std::uint32_t mask, std::size_t base, std::vector<std::size_t>& out) {
+    while (mask != 0) {
+        out.push_back(base + lowest_bit(mask));
+        mask &= mask - 1; // Clear lowest set bit
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Portable scalar kernels (also used for the tails of the vector kernels)
+// ---------------------------------------------------------------------------
+
+const char* find_char_scalar(const char* data, std::size_t length, char target) {
+    if (length == 0) {
+        return nullptr;
+    }
+    return static_cast<const char*>(std::memchr(data, static_cast<unsigned char>(target), length));
+}
+
+void find_newlines_scalar(const char* data, std::size_t length, std::size_t base, std::vector<std::size_t>& out) {
     const char* current = data;
     const char* end = data + length;
-    
-    // Broadcast target character to all lanes of SSE register
-    __m128i target_vec = _mm_set1_epi8(target);
-    
-    // Process 16 bytes at a time using SSE
-    while (current + 16 <= end) {
+    while (const char* newline = find_char_scalar(current, end - current, '\n')) {
+        out.push_back(base + (newline - data));
+        current = newline + 1;
+    }
+}
+
+const char* skip_whitespace_scalar(const char* start, const char* end) {
+    while (start < end && is_skipped_whitespace(*start)) {
+        ++start;
+    }
+    return start;
+}
+
+#if COVERAGE_PARSER_X86
+
+// ---------------------------------------------------------------------------
+// SSE2 kernels (16 bytes per step)
+// ---------------------------------------------------------------------------
+
+COVERAGE_SIMD_TARGET("sse2")
+const char* find_char_sse2(const char* data, std::size_t length, char target) {
+    const char* current = data;
+    const char* end = data + length;
+    const __m128i target_vec = _mm_set1_epi8(target);
+
+    while (end - current >= 16) {
         __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
-        __m128i comparison = _mm_cmpeq_epi8(chunk, target_vec);
-        
-        int mask = _mm_movemask_epi8(comparison);
+        std::uint32_t mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, target_vec)));
         if (mask != 0) {
-            // Found target character, find exact position
-            int pos = _tzcnt_u32(mask);
-            return current + pos;
+            return current + lowest_bit(mask);
         }
-        
         current += 16;
     }
-    
-    // Process remaining bytes
-    while (current < end) {
-        if (*current == target) {
-            return current;
-        }
-        current++;
-    }
-    
-    return nullptr;
+    return find_char_scalar(current, end - current, target);
 }
 
-std::vector<std::size_t> find_newlines_simd(const char* data, std::size_t length) {
-    std::vector<std::size_t> newlines;
-    newlines.reserve(length / 80); // Estimate lines
-    
+COVERAGE_SIMD_TARGET("sse2")
+void find_newlines_sse2(const char* data, std::size_t length, std::vector<std::size_t>& out) {
     const char* current = data;
     const char* end = data + length;
-    
-    __m128i newline_vec = _mm_set1_epi8('\n');
-    
-    while (current + 16 <= end) {
+    const __m128i newline_vec = _mm_set1_epi8('\n');
+
+    while (end - current >= 16) {
         __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
-        __m128i comparison = _mm_cmpeq_epi8(chunk, newline_vec);
-        
-        int mask = _mm_movemask_epi8(comparison);
-        
-        // Process each newline found in this chunk
-        while (mask != 0) {
-            int pos = _tzcnt_u32(mask);
-            newlines.push_back(current - data + pos);
-            mask &= mask - 1; // Clear lowest set bit
+        std::uint32_t mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, newline_vec)));
+        append_positions(mask, current - data, out);
+        current += 16;
+    }
+    find_newlines_scalar(current, end - current, current - data, out);
+}
+
+COVERAGE_SIMD_TARGET("sse2")
+const char* skip_whitespace_sse2(const char* start, const char* end) {
+    const char* current = start;
+    const __m128i space_vec = _mm_set1_epi8(' ');
+    const __m128i tab_vec = _mm_set1_epi8('\t');
+    const __m128i cr_vec = _mm_set1_epi8('\r');
+    const __m128i lf_vec = _mm_set1_epi8('\n');
+
+    while (end - current >= 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+        __m128i is_whitespace = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, space_vec), _mm_cmpeq_epi8(chunk, tab_vec)),
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, cr_vec), _mm_cmpeq_epi8(chunk, lf_vec)));
+
+        std::uint32_t other = ~static_cast<std::uint32_t>(_mm_movemask_epi8(is_whitespace)) & 0xFFFFu;
+        if (other != 0) {
+            return current + lowest_bit(other);
         }
-        
         current += 16;
     }
-    
-    // Process remaining bytes
-    while (current < end) {
-        if (*current == '\n') {
-            newlines.push_back(current - data);
+    return skip_whitespace_scalar(current, end);
+}
+
+// ---------------------------------------------------------------------------
+// AVX2 kernels (32 bytes per step)
+// ---------------------------------------------------------------------------
+
+COVERAGE_SIMD_TARGET("avx2")
+const char* find_char_avx2(const char* data, std::size_t length, char target) {
+    const char* current = data;
+    const char* end = data + length;
+    const __m256i target_vec = _mm256_set1_epi8(target);
+
+    while (end - current >= 32) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(current));
+        std::uint32_t mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, target_vec)));
+        if (mask != 0) {
+            return current + lowest_bit(mask);
         }
-        current++;
+        current += 32;
     }
-    
-    return newlines;
+    return find_char_scalar(current, end - current, target);
 }
 
-const char* skip_whitespace_simd(const char* start, const char* end) {
+COVERAGE_SIMD_TARGET("avx2")
+void find_newlines_avx2(const char* data, std::size_t length, std::vector<std::size_t>& out) {
+    const char* current = data;
+    const char* end = data + length;
+    const __m256i newline_vec = _mm256_set1_epi8('\n');
+
+    while (end - current >= 32) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(current));
+        std::uint32_t mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, newline_vec)));
+        append_positions(mask, current - data, out);
+        current += 32;
+    }
+    find_newlines_scalar(current, end - current, current - data, out);
+}
+
+COVERAGE_SIMD_TARGET("avx2")
+const char* skip_whitespace_avx2(const char* start, const char* end) {
     const char* current = start;
-    
-    // SSE mask for whitespace characters (space, tab, CR, LF)
-    __m128i space_vec = _mm_set1_epi8(' ');
-    __m128i tab_vec = _mm_set1_epi8('\t');
-    __m128i cr_vec = _mm_set1_epi8('\r');
-    __m128i lf_vec = _mm_set1_epi8('\n');
-    
-    while (current + 16 <= end) {
-        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
-        
-        __m128i is_space = _mm_cmpeq_epi8(chunk, space_vec);
-        __m128i is_tab = _mm_cmpeq_epi8(chunk, tab_vec);
-        __m128i is_cr = _mm_cmpeq_epi8(chunk, cr_vec);
-        __m128i is_lf = _mm_cmpeq_epi8(chunk, lf_vec);
-        
-        __m128i is_whitespace = _mm_or_si128(_mm_or_si128(is_space, is_tab), _mm_or_si128(is_cr, is_lf));
-        
-        int mask = _mm_movemask_epi8(is_whitespace);
-        
-        if (mask != 0xFFFF) {
-            // Found non-whitespace character
-            int pos = _tzcnt_u32(~mask);
-            return current + pos;
+    const __m256i space_vec = _mm256_set1_epi8(' ');
+    const __m256i tab_vec = _mm256_set1_epi8('\t');
+    const __m256i cr_vec = _mm256_set1_epi8('\r');
+    const __m256i lf_vec = _mm256_set1_epi8('\n');
+
+    while (end - current >= 32) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(current));
+        __m256i is_whitespace = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, space_vec), _mm256_cmpeq_epi8(chunk, tab_vec)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, cr_vec), _mm256_cmpeq_epi8(chunk, lf_vec)));
+
+        std::uint32_t other = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(is_whitespace));
+        if (other != 0) {
+            return current + lowest_bit(other);
         }
-        
-        current += 16;
+        current += 32;
     }
-    
-    // Process remaining bytes
-    while (current < end && (*current == ' ' || *current == '\t' || *current == '\r' || *current == '\n')) {
-        current++;
+    return skip_whitespace_scalar(current, end);
+}
+
+#if COVERAGE_PARSER_X86_64
+
+// ---------------------------------------------------------------------------
+// AVX-512BW kernels (64 bytes per step, masked loads for the tail)
+// ---------------------------------------------------------------------------
+
+inline unsigned lowest_bit64(std::uint64_t mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward64(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctzll(mask));
+#endif
+}
+
+inline void append_positions64(std::uint64_t mask, std::size_t base, std::vector<std::size_t>& out) {
+    while (mask != 0) {
+        out.push_back(base + lowest_bit64(mask));
+        mask &= mask - 1;
     }
-    
-    return current;
 }
 
-bool parse_uint_simd(const char* start, const char* end, uint32_t& result) {
-    if (start >= end) return false;
-    
-    result = 0;
+// Lane mask covering the first `count` bytes (count < 64)
+inline std::uint64_t tail_mask(std::size_t count) {
+    return (std::uint64_t{1} << count) - 1;
+}
+
+COVERAGE_SIMD_TARGET("avx512f,avx512bw")
+const char* find_char_avx512(const char* data, std::size_t length, char target) {
+    const char* current = data;
+    const char* end = data + length;
+    const __m512i target_vec = _mm512_set1_epi8(target);
+
+    while (end - current >= 64) {
+        __m512i chunk = _mm512_loadu_si512(current);
+        std::uint64_t mask = _mm512_cmpeq_epi8_mask(chunk, target_vec);
+        if (mask != 0) {
+            return current + lowest_bit64(mask);
+        }
+        current += 64;
+    }
+
+    if (current < end) {
+        // Masked-off lanes are never read, so this cannot fault past the buffer
+        __mmask64 live = tail_mask(end - current);
+        __m512i chunk = _mm512_maskz_loadu_epi8(live, current);
+        std::uint64_t mask = _mm512_mask_cmpeq_epi8_mask(live, chunk, target_vec);
+        if (mask != 0) {
+            return current + lowest_bit64(mask);
+        }
+    }
+    return nullptr;
+}
+
+COVERAGE_SIMD_TARGET("avx512f,avx512bw")
+void find_newlines_avx512(const char* data, std::size_t length, std::vector<std::size_t>& out) {
+    const char* current = data;
+    const char* end = data + length;
+    const __m512i newline_vec = _mm512_set1_epi8('\n');
+
+    while (end - current >= 64) {
+        __m512i chunk = _mm512_loadu_si512(current);
+        append_positions64(_mm512_cmpeq_epi8_mask(chunk, newline_vec), current - data, out);
+        current += 64;
+    }
+
+    if (current < end) {
+        __mmask64 live = tail_mask(end - current);
+        __m512i chunk = _mm512_maskz_loadu_epi8(live, current);
+        append_positions64(_mm512_mask_cmpeq_epi8_mask(live, chunk, newline_vec), current - data, out);
+    }
+}
+
+// Whitespace lanes among the `live` bytes starting at `data`
+COVERAGE_SIMD_TARGET("avx512f,avx512bw")
+inline std::uint64_t whitespace_mask_avx512(const char* data, __mmask64 live) {
+    __m512i chunk = _mm512_maskz_loadu_epi8(live, data);
+    return _mm512_mask_cmpeq_epi8_mask(live, chunk, _mm512_set1_epi8(' ')) |
+           _mm512_mask_cmpeq_epi8_mask(live, chunk, _mm512_set1_epi8('\t')) |
+           _mm512_mask_cmpeq_epi8_mask(live, chunk, _mm512_set1_epi8('\r')) |
+           _mm512_mask_cmpeq_epi8_mask(live, chunk, _mm512_set1_epi8('\n'));
+}
+
+COVERAGE_SIMD_TARGET("avx512f,avx512bw")
+const char* skip_whitespace_avx512(const char* start, const char* end) {
     const char* current = start;
-    
-    // Fast path for common case (up to 8 digits)
-    if (end - start <= 8) {
-        while (current < end && *current >= '0' && *current <= '9') {
-            result = result * 10 + (*current - '0');
-            current++;
+
+    while (end - current >= 64) {
+        std::uint64_t other = ~whitespace_mask_avx512(current, ~__mmask64{0});
+        if (other != 0) {
+            return current + lowest_bit64(other);
         }
-        return current == end;
+        current += 64;
     }
-    
-    // Fallback to standard parsing for large numbers
-    char* endptr;
-    unsigned long val = strtoul(start, &endptr, 10);
-    if (endptr == end && val <= UINT32_MAX) {
-        result = static_cast<uint32_t>(val);
-        return true;
+
+    if (current < end) {
+        __mmask64 live = tail_mask(end - current);
+        std::uint64_t other = ~whitespace_mask_avx512(current, live) & live;
+        if (other != 0) {
+            return current + lowest_bit64(other);
+        }
     }
-    
-    return false;
+    return end;
 }
 
-bool parse_double_simd(const char* start, const char* end, double& result) {
-    if (start >= end) return false;
-    
-    // Create null-terminated string for strtod
-    std::string temp(start, end - start);
-    char* endptr;
-    result = strtod(temp.c_str(), &endptr);
-    
-    return endptr == temp.c_str() + temp.length();
+#endif // COVERAGE_PARSER_X86_64
+
+// ---------------------------------------------------------------------------
+// CPU feature detection
+// ---------------------------------------------------------------------------
+
+void cpuid(unsigned leaf, unsigned subleaf, unsigned regs[4]) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (int i = 0; i < 4; ++i) {
+        regs[i] = static_cast<unsigned>(info[i]);
+    }
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
 }
 
-} // namespace simd
+// XCR0: which register states the OS saves on context switch
+std::uint64_t read_xcr0() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    return _xgetbv(0);
+#else
+    std::uint32_t eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<std::uint64_t>(edx) << 32) | eax;
+#endif
+}
 
-// ============================================================================
-// Memory Pool Implementation
-// ============================================================================
+#endif // COVERAGE_PARSER_X86
 
-MemoryPool::MemoryPool(std::size_t chunk_size) : chunk_size_(chunk_size) {
-    // Pre-allocate first chunk
-    Chunk initial_chunk;
-    initial_chunk.memory = _aligned_malloc(chunk_size_, 64); // 64-byte aligned for SIMD
-    initial_chunk.size = chunk_size_;
-    initial_chunk.used = 0;
-    
-    if (initial_chunk.memory) {
-        chunks_.push_back(initial_chunk);
-        total_allocated_ += chunk_size_;
+SimdLevel detect_simd_level() {
+#if COVERAGE_PARSER_X86
+    unsigned regs[4];
+    cpuid(0, 0, regs);
+    const unsigned max_leaf = regs[0];
+
+    cpuid(1, 0, regs);
+    const bool has_sse2 = (regs[3] >> 26) & 1;
+    const bool has_osxsave = (regs[2] >> 27) & 1;
+    const bool has_avx = (regs[2] >> 28) & 1;
+    if (!has_sse2) {
+        return SimdLevel::SCALAR;
+    }
+    if (max_leaf < 7 || !has_osxsave || !has_avx) {
+        return SimdLevel::SSE2;
+    }
+
+    const std::uint64_t xcr0 = read_xcr0();
+    const bool os_saves_ymm = (xcr0 & 0x6) == 0x6;    // XMM | YMM
+    const bool os_saves_zmm = (xcr0 & 0xE6) == 0xE6;  // ... | opmask | ZMM_Hi256 | Hi16_ZMM
+
+    cpuid(7, 0, regs);
+    const bool has_avx2 = (regs[1] >> 5) & 1;
+    const bool has_avx512f = (regs[1] >> 16) & 1;
+    const bool has_avx512bw = (regs[1] >> 30) & 1;
+
+#if COVERAGE_PARSER_X86_64
+    if (os_saves_zmm && has_avx512f && has_avx512bw) {
+        return SimdLevel::AVX512BW;
+    }
+#else
+    (void)os_saves_zmm;
+    (void)has_avx512f;
+    (void)has_avx512bw;
+#endif
+    if (os_saves_ymm && has_avx2) {
+        return SimdLevel::AVX2;
     }
+    return SimdLevel::SSE2;
+#else
+    return SimdLevel::SCALAR;
+#endif
 }
 
-MemoryPool::~MemoryPool() {
-    for (auto& chunk : chunks_) {
-        _aligned_free(chunk.memory);
+// COVERAGE_PARSER_SIMD=scalar|sse2|avx2|avx512 caps the level (benchmarking)
+SimdLevel requested_simd_level(SimdLevel detected) {
+    const char* request = std::getenv("COVERAGE_PARSER_SIMD");
+    if (!request) {
+        return detected;
+    }
+
+    const std::string_view name(request);
+    SimdLevel level = detected;
+    if (name == "scalar") {
+        level = SimdLevel::SCALAR;
+    } else if (name == "sse2") {
+        level = SimdLevel::SSE2;
+    } else if (name == "avx2") {
+        level = SimdLevel::AVX2;
+    } else if (name == "avx512") {
+        level = SimdLevel::AVX512BW;
     }
+    return std::min(level, detected);
 }
 
-void* MemoryPool::allocate(std::size_t size, std::size_t alignment) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    
-    // Align size to requested alignment
-    std::size_t aligned_size = (size + alignment - 1) & ~(alignment - 1);
-    
-    // Find chunk with enough space
-    for (auto& chunk : chunks_) {
-        std::size_t aligned_offset = (chunk.used + alignment - 1) & ~(alignment - 1);
-        if (aligned_offset + aligned_size <= chunk.size) {
-            void* ptr = static_cast<char*>(chunk.memory) + aligned_offset;
-            chunk.used = aligned_offset + aligned_size;
-            return ptr;
+struct KernelTable {
+    SimdLevel detected;
+    SimdLevel active;
+    const char* (*find_char)(const char*, std::size_t, char);
+    void (*find_newlines)(const char*, std::size_t, std::vector<std::size_t>&);
+    const char* (*skip_whitespace)(const char*, const char*);
+};
+
+void find_newlines_portable(const char* data, std::size_t length, std::vector<std::size_t>& out) {
+    find_newlines_scalar(data, length, 0, out);
+}
+
+KernelTable select_kernels(SimdLevel detected, SimdLevel requested) {
+    KernelTable table{};
+    table.detected = detected;
+    table.active = std::min(requested, detected);
+
+    switch (table.active) {
+#if COVERAGE_PARSER_X86
+#if COVERAGE_PARSER_X86_64
+        case SimdLevel::AVX512BW:
+            table.find_char = find_char_avx512;
+            table.find_newlines = find_newlines_avx512;
+            table.skip_whitespace = skip_whitespace_avx512;
+            break;
+#endif
+        case SimdLevel::AVX2:
+            table.find_char = find_char_avx2;
+            table.find_newlines = find_newlines_avx2;
+            table.skip_whitespace = skip_whitespace_avx2;
+            break;
+        case SimdLevel::SSE2:
+            table.find_char = find_char_sse2;
+            table.find_newlines = find_newlines_sse2;
+            table.skip_whitespace = skip_whitespace_sse2;
+            break;
+#endif
+        default:
+            table.active = SimdLevel::SCALAR;
+            table.find_char = find_char_scalar;
+            table.find_newlines = find_newlines_portable;
+            table.skip_whitespace = skip_whitespace_scalar;
+            break;
+    }
+    return table;
+}
+
+// One immutable table per tier. Rebinding swaps the active pointer, so a
+// kernel call racing with set_active_simd_level() uses one whole table or
+// the other, never a mix
+class KernelBinding {
+public:
+    KernelBinding() {
+        const SimdLevel detected = detect_simd_level();
+        for (std::size_t level = 0; level < TIER_COUNT; ++level) {
+            tables_[level] = select_kernels(detected, static_cast<SimdLevel>(level));
         }
+        active_.store(&table(requested_simd_level(detected)), std::memory_order_release);
     }
-    
-    // Allocate new chunk
-    std::size_t new_chunk_size = std::max(chunk_size_, aligned_size + alignment);
-    Chunk new_chunk;
-    new_chunk.memory = _aligned_malloc(new_chunk_size, 64);
-    new_chunk.size = new_chunk_size;
-    new_chunk.used = aligned_size;
-    
-    if (!new_chunk.memory) {
-        return nullptr;
+
+    const KernelTable& active() const { return *active_.load(std::memory_order_acquire); }
+
+    const KernelTable& bind(SimdLevel level) {
+        const KernelTable& bound = table(level);
+        active_.store(&bound, std::memory_order_release);
+        return bound;
     }
-    
-    chunks_.push_back(new_chunk);
-    total_allocated_ += new_chunk_size;
-    
-    return new_chunk.memory;
+
+private:
+    static constexpr std::size_t TIER_COUNT = static_cast<std::size_t>(SimdLevel::AVX512BW) + 1;
+
+    const KernelTable& table(SimdLevel level) const {
+        return tables_[std::min(static_cast<std::size_t>(level), TIER_COUNT - 1)];
+    }
+
+    KernelTable                      tables_[TIER_COUNT];
+    std::atomic<const KernelTable*>  active_{nullptr};
+};
+
+KernelBinding& kernel_binding() {
+    static KernelBinding binding;
+    return binding;
+}
+
+const KernelTable& kernels() {
+    return kernel_binding().active();
+}
+
+// Bind the kernels while the library is loaded instead of on first use
+[[maybe_unused]] const KernelTable& load_time_kernels = kernels();
+
+} // anonymous namespace
+
+SimdLevel detected_simd_level() {
+    return kernels().detected;
+}
+
+SimdLevel active_simd_level() {
+    return kernels().active;
+}
+
+SimdLevel set_active_simd_level(SimdLevel level) {
+    return kernel_binding().bind(level).active;
 }
 
-void MemoryPool::reset() {
-    std::lock_guard<std::mutex> lock(mutex_);
-    for (auto& chunk : chunks_) {
-        chunk.used = 0;
+const char* simd_level_name(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::SCALAR:   return "scalar";
+        case SimdLevel::SSE2:     return "sse2";
+        case SimdLevel::AVX2:     return "avx2";
+        case SimdLevel::AVX512BW: return "avx512bw";
     }
+    return "unknown";
+}
+
+const char* find_char_simd(const char* data, std::size_t length, char target) {
+    return kernels().find_char(data, length, target);
+}
+
+std::vector<std::size_t> find_newlines_simd(const char* data, std::size_t length) {
+    std::vector<std::size_t> newlines;
+    newlines.reserve(length / 80); // Estimate lines
+    kernels().find_newlines(data, length, newlines);
+    return newlines;
+}
+
+const char* skip_whitespace_simd(const char* start, const char* end) {
+    return kernels().skip_whitespace(start, end);
+}
+
+LineScanner::LineScanner(const char* data, std::size_t length)
+    : line_start_(data), block_(data), scanned_(data), end_(data + length) {
+    newlines_.reserve(BLOCK_SIZE / 64);
+}
+
+void LineScanner::index_next_block() {
+    std::size_t length = std::min<std::size_t>(BLOCK_SIZE, end_ - scanned_);
+    block_ = scanned_;
+    newlines_.clear();
+    cursor_ = 0;
+    kernels().find_newlines(block_, length, newlines_);
+    scanned_ += length;
+}
+
+bool parse_uint_simd(const char* start, const char* end, uint32_t& result) {
+    if (start >= end) return false;
+    return utils::try_parse_uint(std::string_view(start, end - start), result);
+}
+
+bool parse_double_simd(const char* start, const char* end, double& result) {
+    if (start >= end) return false;
+    return utils::try_parse_double(std::string_view(start, end - start), result);
 }
 
+} // namespace simd
+
 // ============================================================================
 // Parallel Processing Implementation
 // ============================================================================
 
+namespace {
+
+// The "<label>: N" total from the report header, 0 if the header has none
+std::uint32_t declared_record_total(const MemoryMappedFile& file, std::string_view label) {
+    constexpr std::size_t HEADER_SCAN_BYTES = 8 * 1024;
+    std::string_view header = file.get_view(0, std::min(file.size(), HEADER_SCAN_BYTES));
+    
+    std::size_t label_pos = header.find(label);
+    if (label_pos == std::string_view::npos) {
+        return 0;
+    }
+    std::size_t line_end = header.find('\n', label_pos);
+    std::string_view line = header.substr(label_pos, line_end == std::string_view::npos ? line_end : line_end - label_pos);
+    
+    std::uint32_t total = 0;
+    return utils::try_parse_declared_total(line, label, total) ? total : 0;
+}
+
+// Share of `expected_records` for a chunk holding `chunk_bytes` of `total_bytes`
+std::size_t chunk_record_share(std::size_t expected_records, std::size_t chunk_bytes, std::size_t total_bytes) {
+    if (total_bytes == 0) {
+        return 1;
+    }
+    return static_cast<std::size_t>(static_cast<double>(expected_records) * chunk_bytes / total_bytes) + 1;
+}
+
+} // anonymous namespace
+
 std::vector<ParallelProcessor::FileChunk> ParallelProcessor::create_chunks(
     const MemoryMappedFile& file, 
     std::size_t num_threads
@@ -414,8 +882,9 @@ HighPerformanceGroupsParser::HighPerformanceGroupsParser()
 ParserResult HighPerformanceGroupsParser::parse(const std::string& filename, CoverageDatabase& db) {
     auto start_time = std::chrono::high_resolution_clock::now();
     
-    // Reset stats
+    // Reset stats and recycle the previous parse's chunk buffers
     stats_ = PerformanceStats{};
+    memory_pool_.reset();
     
     // Memory map the file
     MemoryMappedFile file(filename);
@@ -426,37 +895,61 @@ ParserResult HighPerformanceGroupsParser::parse(const std::string& filename, Cov
     stats_.file_size_bytes = file.size();
     
     // Create processing chunks
-    uint32_t num_threads = std::thread::hardware_concurrency();
+    std::shared_ptr<ThreadPool> pool = ThreadPool::shared();
+    uint32_t num_threads = static_cast<uint32_t>(pool->size());
     stats_.threads_used = num_threads;
     
     auto chunks = ParallelProcessor::create_chunks(file, num_threads);
     
+    // Pre-size for the declared total before any chunk creates records
+    const std::size_t expected_groups = utils::expected_record_count(
+        declared_record_total(file, "Total groups in report"), file.size(), utils::TYPICAL_GROUP_LINE_BYTES);
+    try {
+        db.reserve_coverage_groups(db.get_num_groups() + expected_groups);
+    } catch (const std::bad_alloc&) {
+        // Only an optimization: grow on demand instead
+    }
+    
+    // Workers stage their groups in the database's sharded ingest
+    // themselves, so merging scales with the parsing
+    db.begin_ingest();
+    
     // Process chunks in parallel
-    std::vector<std::future<std::pair<ParserResult, std::vector<std::unique_ptr<CoverageGroup>>>>> futures;
+    using ChunkResult = std::tuple<ParserResult, std::size_t, std::size_t>;
+    TaskGroup<ChunkResult> tasks(*pool);
     
-    for (const auto& chunk : chunks) {
-        futures.push_back(std::async(std::launch::async, [this, &file, chunk]() {
-            std::vector<std::unique_ptr<CoverageGroup>> groups;
-            ParserResult result = parse_chunk(file, chunk, groups);
-            return std::make_pair(result, std::move(groups));
-        }));
+    for (auto chunk : chunks) {
+        chunk.expected_records = chunk_record_share(expected_groups, chunk.line_end - chunk.line_start, file.size());
+        const std::uint32_t batch = static_cast<std::uint32_t>(tasks.size());
+        tasks.submit([this, &file, &db, chunk, batch]() {
+            PoolVector<RecordPtr<CoverageGroup>> groups(memory_pool_);
+            std::size_t lines_processed = 0;
+            ParserResult result = parse_chunk(file, chunk, db, groups, lines_processed);
+            if (result == ParserResult::SUCCESS) {
+                db.ingest_coverage_groups(batch, groups.data(), groups.size());
+            }
+            return ChunkResult(result, groups.size(), lines_processed);
+        });
     }
     
-    // Collect results
+    // Collect results; every task must finish before the ingest is closed
     std::size_t total_groups = 0;
-    for (auto& future : futures) {
-        auto [result, groups] = future.get();
-        if (result != ParserResult::SUCCESS) {
-            return result;
-        }
-        
-        // Add groups to database
-        for (auto& group : groups) {
-            db.add_coverage_group(std::move(group));
-            total_groups++;
+    ParserResult status = ParserResult::SUCCESS;
+    for (std::size_t i = 0; i < tasks.size(); ++i) {
+        auto [result, groups_parsed, lines_processed] = tasks.get(i);
+        stats_.lines_processed += lines_processed;
+        total_groups += groups_parsed;
+        if (status == ParserResult::SUCCESS) {
+            status = result;
         }
     }
     
+    if (status != ParserResult::SUCCESS) {
+        db.cancel_ingest();
+        return status;
+    }
+    db.finish_ingest();
+    
     // Calculate performance metrics
     auto end_time = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
@@ -464,7 +957,8 @@ ParserResult HighPerformanceGroupsParser::parse(const std::string& filename, Cov
     stats_.parse_time_seconds = duration.count() / 1000000.0;
     stats_.groups_parsed = total_groups;
     stats_.memory_allocated = memory_pool_.total_allocated();
-    stats_.throughput_mb_per_sec = (stats_.file_size_bytes / (1024.0 * 1024.0)) / stats_.parse_time_seconds;
+    stats_.throughput_mb_per_sec = stats_.parse_time_seconds > 0.0 ?
+        (stats_.file_size_bytes / (1024.0 * 1024.0)) / stats_.parse_time_seconds : 0.0;
     
     return ParserResult::SUCCESS;
 }
@@ -472,37 +966,32 @@ ParserResult HighPerformanceGroupsParser::parse(const std::string& filename, Cov
 ParserResult HighPerformanceGroupsParser::parse_chunk(
     const MemoryMappedFile& file,
     const ParallelProcessor::FileChunk& chunk,
-    std::vector<std::unique_ptr<CoverageGroup>>& groups
+    CoverageDatabase& db,
+    PoolVector<RecordPtr<CoverageGroup>>& groups,
+    std::size_t& lines_processed
 ) {
     const char* start = file.data() + chunk.line_start;
     const char* end = file.data() + chunk.line_end;
-    const char* current = start;
     
-    // Find line boundaries within chunk
-    auto newlines = simd::find_newlines_simd(start, end - start);
+    // Share of the declared total, else an estimate from the chunk size
+    groups.reserve(chunk.expected_records > 0 ? chunk.expected_records :
+                   (end - start) / utils::TYPICAL_GROUP_LINE_BYTES + 1);
     
-    std::size_t line_start_offset = 0;
-    for (std::size_t newline_offset : newlines) {
-        std::size_t line_length = newline_offset - line_start_offset;
-        if (line_length > 0) {
-            std::string_view line(start + line_start_offset, line_length);
-            
-            // Skip headers and empty lines
-            if (line.empty() || line.find("---") != std::string_view::npos || 
-                line.find("COVERED") != std::string_view::npos) {
-                line_start_offset = newline_offset + 1;
-                continue;
-            }
-            
-            // Parse group line
-            auto group = std::make_unique<CoverageGroup>();
-            if (parse_group_line_optimized(line, group) == ParserResult::SUCCESS) {
-                groups.push_back(std::move(group));
-                stats_.lines_processed++;
-            }
+    // Lines are handed out block by block while the block is still in cache
+    simd::LineScanner lines(start, end - start);
+    for (std::string_view line; lines.next(line);) {
+        // Skip headers and empty lines
+        if (line.empty() || line.find("---") != std::string_view::npos || 
+            line.find("COVERED") != std::string_view::npos) {
+            continue;
         }
         
-        line_start_offset = newline_offset + 1;
+        // Parse group line
+        auto group = db.create_coverage_group();
+        if (parse_group_line_optimized(line, db, group) == ParserResult::SUCCESS) {
+            groups.push_back(std::move(group));
+            lines_processed++;
+        }
     }
     
     return ParserResult::SUCCESS;
@@ -510,9 +999,12 @@ ParserResult HighPerformanceGroupsParser::parse_chunk(
 
 ParserResult HighPerformanceGroupsParser::parse_group_line_optimized(
     std::string_view line,
-    std::unique_ptr<CoverageGroup>& group
+    CoverageDatabase& db,
+    RecordPtr<CoverageGroup>& group
 ) {
-    auto tokens = tokenize_line_simd(line);
+    // 11 numeric/flag fields, then the group name as the rest of the line
+    tokenizer::FieldBuffer<12> tokens;
+    tokenizer::split_with_tail(line, 11, tokens);
     
     if (tokens.size() < 12) {
         return ParserResult::ERROR_INVALID_FORMAT;
@@ -553,10 +1045,8 @@ ParserResult HighPerformanceGroupsParser::parse_group_line_optimized(
             group->print_missing = print_missing;
         }
         
-        // Extract group name (last token)
-        if (tokens.size() > 12) {
-            group->name = std::string(tokens[12]);
-        }
+        // Rest of the line is the group name
+        group->name = db.intern(tokens[11]);
         
         return ParserResult::SUCCESS;
         
@@ -565,31 +1055,1008 @@ ParserResult HighPerformanceGroupsParser::parse_group_line_optimized(
     }
 }
 
-std::vector<std::string_view> HighPerformanceGroupsParser::tokenize_line_simd(std::string_view line) {
-    std::vector<std::string_view> tokens;
-    tokens.reserve(15); // Typical number of fields
+// ============================================================================
+// High-Performance Hierarchy Parser Implementation
+// ============================================================================
+
+HighPerformanceHierarchyParser::HighPerformanceHierarchyParser()
+    : memory_pool_(1024 * 1024) // 1MB chunks
+{
+}
+
+ParserResult HighPerformanceHierarchyParser::parse(const std::string& filename, CoverageDatabase& db) {
+    auto start_time = std::chrono::high_resolution_clock::now();
     
-    const char* start = line.data();
-    const char* end = start + line.size();
-    const char* current = start;
+    // Reset stats
+    stats_ = HighPerformanceGroupsParser::PerformanceStats{};
+    memory_pool_.reset();
     
-    while (current < end) {
-        // Skip whitespace using SIMD
-        current = simd::skip_whitespace_simd(current, end);
-        if (current >= end) break;
+    // Memory map the file
+    MemoryMappedFile file(filename);
+    if (!file.is_valid()) {
+        return ParserResult::ERROR_FILE_NOT_FOUND;
+    }
+    
+    stats_.file_size_bytes = file.size();
+    
+    // Instances only appear after the "SCORE ASSERT" column header
+    std::size_t data_offset = find_data_section(file);
+    if (data_offset == std::string::npos) {
+        return ParserResult::ERROR_INVALID_FORMAT;
+    }
+    
+    // Create processing chunks
+    std::shared_ptr<ThreadPool> pool = ThreadPool::shared();
+    uint32_t num_threads = static_cast<uint32_t>(pool->size());
+    stats_.threads_used = num_threads;
+    
+    auto chunks = ParallelProcessor::create_chunks(file, num_threads);
+    
+    // The header declares no total: pre-size from the data section's size
+    const std::size_t data_bytes = file.size() - data_offset;
+    const std::size_t expected_instances = utils::expected_record_count(
+        0, data_bytes, utils::TYPICAL_HIERARCHY_LINE_BYTES, config_.max_instances);
+    try {
+        db.reserve_hierarchy_instances(db.get_num_hierarchy_instances() + expected_instances);
+    } catch (const std::bad_alloc&) {
+        // Only an optimization: grow on demand instead
+    }
+    
+    // Without a record cap, workers stage their records in the database's
+    // sharded ingest themselves, so merging scales with the parsing. A cap
+    // counts records in file order, which only the calling thread can do.
+    const bool sharded = config_.max_instances == 0;
+    if (sharded) {
+        db.begin_ingest();
+    }
+    
+    // Process chunks in parallel; the error budget covers the whole file
+    using ChunkResult = std::tuple<ParserResult, PoolVector<RecordPtr<HierarchyInstance>>, std::size_t>;
+    TaskGroup<ChunkResult> tasks(*pool);
+    std::atomic<std::uint32_t> parse_errors{0};
+    
+    for (auto chunk : chunks) {
+        if (chunk.line_end <= data_offset) {
+            continue;
+        }
+        chunk.line_start = std::max(chunk.line_start, data_offset);
+        chunk.expected_records = chunk_record_share(expected_instances, chunk.line_end - chunk.line_start, data_bytes);
         
-        // Find end of token
-        const char* token_start = current;
-        while (current < end && *current != ' ' && *current != '\t') {
-            current++;
+        const std::uint32_t batch = static_cast<std::uint32_t>(tasks.size());
+        tasks.submit([this, &file, &db, &parse_errors, chunk, batch, sharded]() {
+            PoolVector<RecordPtr<HierarchyInstance>> instances(memory_pool_);
+            std::size_t lines_processed = 0;
+            ParserResult result = parse_chunk(file, chunk, db, instances, lines_processed, parse_errors);
+            if (sharded && result == ParserResult::SUCCESS) {
+                db.ingest_hierarchy_instances(batch, instances.data(), instances.size());
+            }
+            return ChunkResult(result, std::move(instances), lines_processed);
+        });
+    }
+    
+    // Collect results in file order
+    std::size_t total_instances = 0;
+    ParserResult status = ParserResult::SUCCESS;
+    for (std::size_t i = 0; i < tasks.size(); ++i) {
+        auto [result, instances, lines_processed] = tasks.get(i);
+        stats_.lines_processed += lines_processed;
+        if (status != ParserResult::SUCCESS) {
+            continue; // Drain remaining tasks before returning
+        }
+        if (result != ParserResult::SUCCESS) {
+            status = result;
+            continue;
         }
         
-        if (current > token_start) {
-            tokens.emplace_back(token_start, current - token_start);
+        // Staged instances only need counting
+        if (sharded) {
+            total_instances += instances.size();
+            continue;
+        }
+        for (auto& instance : instances) {
+            if (config_.max_instances > 0 && total_instances >= config_.max_instances) {
+                break;
+            }
+            db.add_hierarchy_instance(std::move(instance));
+            total_instances++;
+        }
+    }
+    
+    if (status != ParserResult::SUCCESS) {
+        if (sharded) {
+            db.cancel_ingest();
         }
+        return status;
+    }
+    if (sharded) {
+        db.finish_ingest();
     }
     
-    return tokens;
+    // Calculate performance metrics
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
+    
+    stats_.parse_time_seconds = duration.count() / 1000000.0;
+    stats_.groups_parsed = total_instances;
+    stats_.memory_allocated = memory_pool_.total_allocated();
+    stats_.throughput_mb_per_sec = stats_.parse_time_seconds > 0.0 ?
+        (stats_.file_size_bytes / (1024.0 * 1024.0)) / stats_.parse_time_seconds : 0.0;
+    
+    return ParserResult::SUCCESS;
+}
+
+std::size_t HighPerformanceHierarchyParser::find_data_section(const MemoryMappedFile& file) {
+    const char* data = file.data();
+    std::size_t size = file.size();
+    std::size_t line_start = 0;
+    
+    while (line_start < size) {
+        const char* newline = simd::find_char_simd(data + line_start, size - line_start, '\n');
+        std::size_t line_end = newline ? static_cast<std::size_t>(newline - data) : size;
+        std::string_view line(data + line_start, line_end - line_start);
+        
+        if (line.find("SCORE") != std::string_view::npos &&
+            line.find("ASSERT") != std::string_view::npos) {
+            return newline ? line_end + 1 : size;
+        }
+        
+        line_start = line_end + 1;
+    }
+    
+    return std::string::npos;
+}
+
+ParserResult HighPerformanceHierarchyParser::parse_chunk(
+    const MemoryMappedFile& file,
+    const ParallelProcessor::FileChunk& chunk,
+    CoverageDatabase& db,
+    PoolVector<RecordPtr<HierarchyInstance>>& instances,
+    std::size_t& lines_processed,
+    std::atomic<std::uint32_t>& parse_errors
+) {
+    const char* start = file.data() + chunk.line_start;
+    const char* end = file.data() + chunk.line_end;
+    
+    // Share of the expected total, else an estimate from the chunk size
+    instances.reserve(chunk.expected_records > 0 ? chunk.expected_records :
+                      (end - start) / utils::TYPICAL_HIERARCHY_LINE_BYTES + 1);
+    
+    simd::LineScanner lines(start, end - start);
+    for (std::string_view line; lines.next(line);) {
+        lines_processed++;
+        
+        // Same data line rule as HierarchyParser
+        if (!line_classifier::is_hierarchy_data_line(line)) {
+            continue;
+        }
+        
+        auto instance = db.create_hierarchy_instance();
+        if (parse_hierarchy_line_optimized(line, db, instance) != ParserResult::SUCCESS) {
+            // More than 20 malformed lines in the file, counted across all chunks
+            if (parse_errors.fetch_add(1, std::memory_order_relaxed) + 1 > 20) {
+                return ParserResult::ERROR_PARSE_FAILED;
+            }
+            continue;
+        }
+        
+        // Skip instances below coverage threshold if configured
+        if (instance->total_score < config_.min_coverage_threshold) {
+            continue;
+        }
+        
+        instances.push_back(std::move(instance));
+    }
+    
+    return ParserResult::SUCCESS;
+}
+
+ParserResult HighPerformanceHierarchyParser::parse_hierarchy_line_optimized(
+    std::string_view line,
+    CoverageDatabase& db,
+    RecordPtr<HierarchyInstance>& instance
+) {
+    // Three score fields, then the instance path as the rest of the line
+    tokenizer::FieldBuffer<4> fields;
+    tokenizer::split_with_tail(line, 3, fields);
+    if (fields.size() < 4) {
+        return ParserResult::ERROR_INVALID_FORMAT;
+    }
+    
+    std::string_view total_score = fields[0];
+    std::string_view assert_score = fields[1];
+    std::string_view assert_fraction = fields[2];
+    
+    // Parse coverage scores
+    if (!simd::parse_double_simd(total_score.data(), total_score.data() + total_score.size(), instance->total_score) ||
+        !simd::parse_double_simd(assert_score.data(), assert_score.data() + assert_score.size(), instance->assert_coverage.score)) {
+        return ParserResult::ERROR_PARSE_FAILED;
+    }
+    
+    // Parse assert coverage fraction (format: "covered/expected")
+    std::size_t slash_pos = assert_fraction.find('/');
+    if (slash_pos == std::string_view::npos ||
+        !simd::parse_uint_simd(assert_fraction.data(), assert_fraction.data() + slash_pos, instance->assert_coverage.covered) ||
+        !simd::parse_uint_simd(assert_fraction.data() + slash_pos + 1, assert_fraction.data() + assert_fraction.size(), instance->assert_coverage.expected)) {
+        return ParserResult::ERROR_PARSE_FAILED;
+    }
+    instance->assert_coverage.is_valid = true;
+    
+    instance->instance_path = db.intern(fields[3]);
+    
+    // Calculate hierarchy depth, module name and leaf status
+    classify_instance(*instance, db);
+    
+    return ParserResult::SUCCESS;
+}
+
+// ============================================================================
+// High-Performance Assert Parser Implementation
+// ============================================================================
+
+namespace {
+
+inline bool is_status_keyword(std::string_view token) {
+    return token == "PASS" || token == "FAIL" || token == "COVERED" || token == "UNCOVERED";
+}
+
+} // anonymous namespace
+
+HighPerformanceAssertParser::HighPerformanceAssertParser()
+    : memory_pool_(1024 * 1024) // 1MB chunks
+{
+}
+
+ParserResult HighPerformanceAssertParser::parse(const std::string& filename, CoverageDatabase& db) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    
+    // Reset stats
+    stats_ = HighPerformanceGroupsParser::PerformanceStats{};
+    memory_pool_.reset();
+    
+    // Memory map the file
+    MemoryMappedFile file(filename);
+    if (!file.is_valid()) {
+        return ParserResult::ERROR_FILE_NOT_FOUND;
+    }
+    
+    stats_.file_size_bytes = file.size();
+    
+    // Headerless files are parsed from the first byte, like AssertParser does
+    std::size_t data_offset = find_data_section(file);
+    if (data_offset == std::string::npos) {
+        data_offset = 0;
+    }
+    
+    // Decide the line layout once for the whole file
+    if (!detect_layout(file, data_offset, layout_)) {
+        return ParserResult::SUCCESS; // No assertion lines at all
+    }
+    
+    // Create processing chunks
+    std::shared_ptr<ThreadPool> pool = ThreadPool::shared();
+    uint32_t num_threads = static_cast<uint32_t>(pool->size());
+    stats_.threads_used = num_threads;
+    
+    auto chunks = ParallelProcessor::create_chunks(file, num_threads);
+    
+    // Pre-size for the declared total before any chunk creates records
+    const std::size_t data_bytes = file.size() - data_offset;
+    const std::size_t expected_asserts = utils::expected_record_count(
+        declared_record_total(file, "Total Assertions"), data_bytes, utils::TYPICAL_ASSERT_LINE_BYTES);
+    try {
+        db.reserve_assert_coverage(db.get_num_asserts() + expected_asserts);
+    } catch (const std::bad_alloc&) {
+        // Only an optimization: grow on demand instead
+    }
+    
+    // Workers stage their records in the database's sharded ingest
+    // themselves, so merging scales with the parsing
+    db.begin_ingest();
+    
+    // Process chunks in parallel; the error budget covers the whole file
+    using ChunkResult = std::tuple<ParserResult, PoolVector<RecordPtr<AssertCoverage>>, std::size_t>;
+    TaskGroup<ChunkResult> tasks(*pool);
+    std::atomic<std::uint32_t> parse_errors{0};
+    
+    for (auto chunk : chunks) {
+        if (chunk.line_end <= data_offset) {
+            continue;
+        }
+        chunk.line_start = std::max(chunk.line_start, data_offset);
+        chunk.expected_records = chunk_record_share(expected_asserts, chunk.line_end - chunk.line_start, data_bytes);
+        
+        const std::uint32_t batch = static_cast<std::uint32_t>(tasks.size());
+        tasks.submit([this, &file, &db, &parse_errors, chunk, batch]() {
+            PoolVector<RecordPtr<AssertCoverage>> asserts(memory_pool_);
+            std::size_t lines_processed = 0;
+            ParserResult result = parse_chunk(file, chunk, db, asserts, lines_processed, parse_errors);
+            if (result == ParserResult::SUCCESS) {
+                db.ingest_assert_coverage(batch, asserts.data(), asserts.size());
+            }
+            return ChunkResult(result, std::move(asserts), lines_processed);
+        });
+    }
+    
+    // Collect results in file order
+    std::size_t total_asserts = 0;
+    ParserResult status = ParserResult::SUCCESS;
+    for (std::size_t i = 0; i < tasks.size(); ++i) {
+        auto [result, asserts, lines_processed] = tasks.get(i);
+        stats_.lines_processed += lines_processed;
+        if (status != ParserResult::SUCCESS) {
+            continue; // Drain remaining tasks before returning
+        }
+        if (result != ParserResult::SUCCESS) {
+            status = result;
+            continue;
+        }
+        
+        total_asserts += asserts.size();  // Already staged by the worker
+    }
+    
+    if (status != ParserResult::SUCCESS) {
+        db.cancel_ingest();
+        return status;
+    }
+    db.finish_ingest();
+    
+    // Calculate performance metrics
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
+    
+    stats_.parse_time_seconds = duration.count() / 1000000.0;
+    stats_.groups_parsed = total_asserts;
+    stats_.memory_allocated = memory_pool_.total_allocated();
+    stats_.throughput_mb_per_sec = stats_.parse_time_seconds > 0.0 ?
+        (stats_.file_size_bytes / (1024.0 * 1024.0)) / stats_.parse_time_seconds : 0.0;
+    
+    return ParserResult::SUCCESS;
+}
+
+std::size_t HighPerformanceAssertParser::find_data_section(const MemoryMappedFile& file) {
+    const char* data = file.data();
+    std::size_t size = file.size();
+    std::size_t line_start = 0;
+    
+    while (line_start < size) {
+        const char* newline = simd::find_char_simd(data + line_start, size - line_start, '\n');
+        std::size_t line_end = newline ? static_cast<std::size_t>(newline - data) : size;
+        std::string_view line(data + line_start, line_end - line_start);
+        
+        // Same column headers AssertParser looks for
+        if ((line.find("STATUS") != std::string_view::npos && line.find("ASSERTION") != std::string_view::npos) ||
+            (line.find("ASSERT") != std::string_view::npos && line.find("NAME") != std::string_view::npos)) {
+            return newline ? line_end + 1 : size;
+        }
+        
+        line_start = line_end + 1;
+    }
+    
+    return std::string::npos;
+}
+
+bool HighPerformanceAssertParser::detect_layout(const MemoryMappedFile& file, std::size_t data_offset, LineLayout& layout) {
+    const char* data = file.data();
+    std::size_t size = file.size();
+    std::size_t line_start = data_offset;
+    
+    while (line_start < size) {
+        const char* newline = simd::find_char_simd(data + line_start, size - line_start, '\n');
+        std::size_t line_end = newline ? static_cast<std::size_t>(newline - data) : size;
+        std::string_view line(data + line_start, line_end - line_start);
+        line_start = line_end + 1;
+        
+        if (line.find("---") != std::string_view::npos || is_header_text(line)) {
+            continue;
+        }
+        
+        std::size_t pos = 0;
+        std::string_view first = tokenizer::next_field(line, pos);
+        if (first.empty()) {
+            continue;
+        }
+        
+        // Same precedence as RecordReader::decode_assert
+        if (is_status_keyword(first)) {
+            layout = LineLayout::STATUS_HITS;
+        } else if (first.find('/') != std::string_view::npos) {
+            layout = LineLayout::COVERAGE_FRACTION;
+        } else {
+            layout = LineLayout::NAME_PATH_STATUS;
+        }
+        return true;
+    }
+    
+    return false;
+}
+
+bool HighPerformanceAssertParser::is_header_text(std::string_view line) {
+    return line.find("Assertion Coverage Report") != std::string_view::npos ||
+           line.find("Total Assertions") != std::string_view::npos ||
+           line.find("Coverage:") != std::string_view::npos ||
+           line.find("STATUS") != std::string_view::npos ||
+           line.find("HITS") != std::string_view::npos ||
+           line.find("ASSERTION") != std::string_view::npos ||
+           line.find("INSTANCE") != std::string_view::npos ||
+           line.find("FILE:LINE") != std::string_view::npos;
+}
+
+ParserResult HighPerformanceAssertParser::parse_chunk(
+    const MemoryMappedFile& file,
+    const ParallelProcessor::FileChunk& chunk,
+    CoverageDatabase& db,
+    PoolVector<RecordPtr<AssertCoverage>>& asserts,
+    std::size_t& lines_processed,
+    std::atomic<std::uint32_t>& parse_errors
+) const {
+    const char* start = file.data() + chunk.line_start;
+    const char* end = file.data() + chunk.line_end;
+    
+    // Select the specialized line parser once per chunk
+    ParserResult (*parse_line)(std::string_view, CoverageDatabase&, AssertCoverage&) = nullptr;
+    switch (layout_) {
+        case LineLayout::STATUS_HITS:       parse_line = &parse_status_hits_line; break;
+        case LineLayout::COVERAGE_FRACTION: parse_line = &parse_coverage_fraction_line; break;
+        case LineLayout::NAME_PATH_STATUS:  parse_line = &parse_name_path_status_line; break;
+    }
+    
+    // Share of the declared total, else an estimate from the chunk size
+    asserts.reserve(chunk.expected_records > 0 ? chunk.expected_records :
+                    (end - start) / utils::TYPICAL_ASSERT_LINE_BYTES + 1);
+    
+    simd::LineScanner lines(start, end - start);
+    for (std::string_view line; lines.next(line);) {
+        lines_processed++;
+        
+        // Skip blank lines and separators
+        const char* first = simd::skip_whitespace_simd(line.data(), line.data() + line.size());
+        if (first == line.data() + line.size() || *first == '-') {
+            continue;
+        }
+        
+        // Only data lines of the file's layout reach the line parser, so
+        // summary lines ("Coverage: 66.6%", "Failed: 3") are skipped rather
+        // than counted against the error budget
+        if (layout_ == LineLayout::STATUS_HITS) {
+            if (!line_classifier::is_assert_status_line(line) || is_header_text(line)) {
+                continue;
+            }
+        } else if (layout_ == LineLayout::COVERAGE_FRACTION) {
+            if (!line_classifier::is_assert_fraction_line(line) || is_header_text(line)) {
+                continue;
+            }
+        } else if (is_header_text(line)) {
+            continue;
+        }
+        
+        auto assert_cov = db.create_assert_coverage();
+        if (parse_line(line, db, *assert_cov) != ParserResult::SUCCESS) {
+            // More than 50 malformed lines in the file, counted across all chunks
+            if (parse_errors.fetch_add(1, std::memory_order_relaxed) + 1 > 50) {
+                return ParserResult::ERROR_PARSE_FAILED;
+            }
+            continue;
+        }
+        
+        // Set default severity if not specified
+        if (assert_cov->severity.empty()) {
+            assert_cov->severity = db.intern(assert_cov->is_covered ? "PASS" : "FAIL");
+        }
+        
+        // Generate a unique key for the assertion
+        if (assert_cov->assert_name.empty()) {
+            assert_cov->assert_name = db.intern(assert_cov->instance_path + "_" + std::to_string(assert_cov->line_number));
+        }
+        
+        asserts.push_back(std::move(assert_cov));
+    }
+    
+    return ParserResult::SUCCESS;
+}
+
+ParserResult HighPerformanceAssertParser::parse_status_hits_line(std::string_view line, CoverageDatabase& db, AssertCoverage& assert_cov) {
+    std::size_t pos = 0;
+    std::string_view status = tokenizer::next_field(line, pos);
+    std::string_view hits = tokenizer::next_field(line, pos);
+    std::string_view name = tokenizer::next_field(line, pos);
+    std::string_view path = tokenizer::next_field(line, pos);
+    std::string_view file_line = tokenizer::next_field(line, pos);
+    
+    if (name.empty() || !is_status_keyword(status)) {
+        return ParserResult::ERROR_INVALID_FORMAT;
+    }
+    
+    assert_cov.is_covered = (status == "PASS" || status == "COVERED");
+    assert_cov.severity = db.intern(status);
+    
+    if (!simd::parse_uint_simd(hits.data(), hits.data() + hits.size(), assert_cov.hit_count)) {
+        assert_cov.hit_count = assert_cov.is_covered ? 1 : 0;
+    }
+    
+    assert_cov.assert_name = db.intern(name);
+    assert_cov.instance_path = db.intern(path);
+    
+    if (!file_line.empty()) {
+        std::size_t colon_pos = file_line.rfind(':');
+        if (colon_pos != std::string_view::npos) {
+            assert_cov.file_location = db.intern(file_line.substr(0, colon_pos));
+            if (!simd::parse_uint_simd(file_line.data() + colon_pos + 1, file_line.data() + file_line.size(), assert_cov.line_number)) {
+                assert_cov.line_number = 0;
+            }
+        } else {
+            assert_cov.file_location = db.intern(file_line);
+        }
+    }
+    
+    return ParserResult::SUCCESS;
+}
+
+ParserResult HighPerformanceAssertParser::parse_coverage_fraction_line(std::string_view line, CoverageDatabase& db, AssertCoverage& assert_cov) {
+    std::size_t pos = 0;
+    std::string_view fraction = tokenizer::next_field(line, pos);
+    std::string_view name = tokenizer::next_field(line, pos);
+    std::string_view path = tokenizer::next_field(line, pos);
+    
+    if (path.empty()) {
+        return ParserResult::ERROR_INVALID_FORMAT;
+    }
+    
+    std::size_t slash_pos = fraction.find('/');
+    std::uint32_t covered = 0;
+    std::uint32_t expected = 0;
+    if (slash_pos == std::string_view::npos ||
+        !simd::parse_uint_simd(fraction.data(), fraction.data() + slash_pos, covered) ||
+        !simd::parse_uint_simd(fraction.data() + slash_pos + 1, fraction.data() + fraction.size(), expected)) {
+        return ParserResult::ERROR_PARSE_FAILED;
+    }
+    
+    assert_cov.is_covered = (covered > 0);
+    assert_cov.hit_count = covered;
+    assert_cov.assert_name = db.intern(name);
+    assert_cov.instance_path = db.intern(path);
+    
+    return ParserResult::SUCCESS;
+}
+
+ParserResult HighPerformanceAssertParser::parse_name_path_status_line(std::string_view line, CoverageDatabase& db, AssertCoverage& assert_cov) {
+    std::size_t pos = 0;
+    std::string_view name = tokenizer::next_field(line, pos);
+    std::string_view path = tokenizer::next_field(line, pos);
+    std::string_view status = tokenizer::next_field(line, pos);
+    
+    if (status.empty()) {
+        return ParserResult::ERROR_INVALID_FORMAT;
+    }
+    
+    assert_cov.assert_name = db.intern(name);
+    assert_cov.instance_path = db.intern(path);
+    assert_cov.is_covered = (status == "COVERED" || status == "PASS" || status == "1");
+    assert_cov.hit_count = assert_cov.is_covered ? 1 : 0;
+    
+    return ParserResult::SUCCESS;
+}
+
+// ============================================================================
+// High-Performance Module List Parser Implementation
+// ============================================================================
+
+HighPerformanceModuleListParser::HighPerformanceModuleListParser()
+    : memory_pool_(1024 * 1024) // 1MB chunks
+{
+}
+
+ParserResult HighPerformanceModuleListParser::parse(const std::string& filename, CoverageDatabase& db) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    
+    // Reset stats
+    stats_ = HighPerformanceGroupsParser::PerformanceStats{};
+    memory_pool_.reset();
+    
+    // Memory map the file
+    MemoryMappedFile file(filename);
+    if (!file.is_valid()) {
+        return ParserResult::ERROR_FILE_NOT_FOUND;
+    }
+    
+    stats_.file_size_bytes = file.size();
+    
+    // Modules only appear after the "SCORE ASSERT NAME" column header
+    std::size_t data_offset = find_data_section(file);
+    if (data_offset == std::string::npos) {
+        return ParserResult::ERROR_INVALID_FORMAT;
+    }
+    
+    // Create processing chunks
+    std::shared_ptr<ThreadPool> pool = ThreadPool::shared();
+    uint32_t num_threads = static_cast<uint32_t>(pool->size());
+    stats_.threads_used = num_threads;
+    
+    auto chunks = ParallelProcessor::create_chunks(file, num_threads);
+    
+    // Pre-size for the declared total before any chunk creates records
+    const std::size_t data_bytes = file.size() - data_offset;
+    const std::size_t expected_modules = utils::expected_record_count(
+        declared_record_total(file, "Total modules in report"), data_bytes, utils::TYPICAL_MODULE_LINE_BYTES,
+        config_.max_instances);
+    try {
+        db.reserve_module_definitions(db.get_num_modules() + expected_modules);
+    } catch (const std::bad_alloc&) {
+        // Only an optimization: grow on demand instead
+    }
+    
+    // Without a record cap, workers stage their records in the database's
+    // sharded ingest themselves, so merging scales with the parsing. A cap
+    // counts records in file order, which only the calling thread can do.
+    const bool sharded = config_.max_instances == 0;
+    if (sharded) {
+        db.begin_ingest();
+    }
+    
+    // Process chunks in parallel; the error budget covers the whole file
+    using ChunkResult = std::tuple<ParserResult, PoolVector<RecordPtr<ModuleDefinition>>, std::size_t>;
+    TaskGroup<ChunkResult> tasks(*pool);
+    std::atomic<std::uint32_t> parse_errors{0};
+    
+    for (auto chunk : chunks) {
+        if (chunk.line_end <= data_offset) {
+            continue;
+        }
+        chunk.line_start = std::max(chunk.line_start, data_offset);
+        chunk.expected_records = chunk_record_share(expected_modules, chunk.line_end - chunk.line_start, data_bytes);
+        
+        const std::uint32_t batch = static_cast<std::uint32_t>(tasks.size());
+        tasks.submit([this, &file, &db, &parse_errors, chunk, batch, sharded]() {
+            PoolVector<RecordPtr<ModuleDefinition>> modules(memory_pool_);
+            std::size_t lines_processed = 0;
+            ParserResult result = parse_chunk(file, chunk, db, modules, lines_processed, parse_errors);
+            if (sharded && result == ParserResult::SUCCESS) {
+                db.ingest_module_definitions(batch, modules.data(), modules.size());
+            }
+            return ChunkResult(result, std::move(modules), lines_processed);
+        });
+    }
+    
+    // Collect results in file order
+    std::size_t total_modules = 0;
+    ParserResult status = ParserResult::SUCCESS;
+    for (std::size_t i = 0; i < tasks.size(); ++i) {
+        auto [result, modules, lines_processed] = tasks.get(i);
+        stats_.lines_processed += lines_processed;
+        if (status != ParserResult::SUCCESS) {
+            continue; // Drain remaining tasks before returning
+        }
+        if (result != ParserResult::SUCCESS) {
+            status = result;
+            continue;
+        }
+        
+        // Staged modules only need counting
+        if (sharded) {
+            total_modules += modules.size();
+            continue;
+        }
+        for (auto& module : modules) {
+            if (config_.max_instances > 0 && total_modules >= config_.max_instances) {
+                break;
+            }
+            db.add_module_definition(std::move(module));
+            total_modules++;
+        }
+    }
+    
+    if (status != ParserResult::SUCCESS) {
+        if (sharded) {
+            db.cancel_ingest();
+        }
+        return status;
+    }
+    if (sharded) {
+        db.finish_ingest();
+    }
+    
+    // Calculate performance metrics
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
+    
+    stats_.parse_time_seconds = duration.count() / 1000000.0;
+    stats_.groups_parsed = total_modules;
+    stats_.memory_allocated = memory_pool_.total_allocated();
+    stats_.throughput_mb_per_sec = stats_.parse_time_seconds > 0.0 ?
+        (stats_.file_size_bytes / (1024.0 * 1024.0)) / stats_.parse_time_seconds : 0.0;
+    
+    return ParserResult::SUCCESS;
+}
+
+std::size_t HighPerformanceModuleListParser::find_data_section(const MemoryMappedFile& file) {
+    const char* data = file.data();
+    std::size_t size = file.size();
+    std::size_t line_start = 0;
+    
+    while (line_start < size) {
+        const char* newline = simd::find_char_simd(data + line_start, size - line_start, '\n');
+        std::size_t line_end = newline ? static_cast<std::size_t>(newline - data) : size;
+        std::string_view line(data + line_start, line_end - line_start);
+        
+        if (line.find("SCORE") != std::string_view::npos &&
+            line.find("ASSERT") != std::string_view::npos &&
+            line.find("NAME") != std::string_view::npos) {
+            return newline ? line_end + 1 : size;
+        }
+        
+        line_start = line_end + 1;
+    }
+    
+    return std::string::npos;
+}
+
+ParserResult HighPerformanceModuleListParser::parse_chunk(
+    const MemoryMappedFile& file,
+    const ParallelProcessor::FileChunk& chunk,
+    CoverageDatabase& db,
+    PoolVector<RecordPtr<ModuleDefinition>>& modules,
+    std::size_t& lines_processed,
+    std::atomic<std::uint32_t>& parse_errors
+) {
+    const char* start = file.data() + chunk.line_start;
+    const char* end = file.data() + chunk.line_end;
+    
+    // Share of the declared total, else an estimate from the chunk size
+    modules.reserve(chunk.expected_records > 0 ? chunk.expected_records :
+                    (end - start) / utils::TYPICAL_MODULE_LINE_BYTES + 1);
+    
+    simd::LineScanner lines(start, end - start);
+    for (std::string_view line; lines.next(line);) {
+        lines_processed++;
+        
+        // Same data line rule as ModuleListParser
+        if (!line_classifier::is_module_data_line(line)) {
+            continue;
+        }
+        
+        // ModuleListParser drops any line mentioning a column title
+        if (line.find("SCORE") != std::string_view::npos ||
+            line.find("ASSERT") != std::string_view::npos ||
+            line.find("NAME") != std::string_view::npos) {
+            continue;
+        }
+        
+        auto module = db.create_module_definition();
+        if (parse_module_line_optimized(line, db, module) != ParserResult::SUCCESS) {
+            // More than 10 malformed lines in the file, counted across all chunks
+            if (parse_errors.fetch_add(1, std::memory_order_relaxed) + 1 > 10) {
+                return ParserResult::ERROR_PARSE_FAILED;
+            }
+            continue;
+        }
+        
+        // Skip modules below coverage threshold if configured
+        if (module->total_score < config_.min_coverage_threshold) {
+            continue;
+        }
+        
+        // Skip empty modules if configured
+        if (config_.ignore_empty_groups && module->assert_coverage.expected == 0) {
+            continue;
+        }
+        
+        modules.push_back(std::move(module));
+    }
+    
+    return ParserResult::SUCCESS;
+}
+
+ParserResult HighPerformanceModuleListParser::parse_module_line_optimized(
+    std::string_view line,
+    CoverageDatabase& db,
+    RecordPtr<ModuleDefinition>& module
+) const {
+    // Three score fields, then the module name as the rest of the line
+    tokenizer::FieldBuffer<4> fields;
+    tokenizer::split_with_tail(line, 3, fields);
+    if (fields.size() < 4) {
+        return ParserResult::ERROR_INVALID_FORMAT;
+    }
+    
+    std::string_view total_score = fields[0];
+    std::string_view assert_score = fields[1];
+    std::string_view assert_fraction = fields[2];
+    
+    // Parse coverage scores
+    if (!simd::parse_double_simd(total_score.data(), total_score.data() + total_score.size(), module->total_score) ||
+        !simd::parse_double_simd(assert_score.data(), assert_score.data() + assert_score.size(), module->assert_coverage.score)) {
+        return ParserResult::ERROR_PARSE_FAILED;
+    }
+    
+    // Parse assert coverage fraction (format: "covered/expected")
+    std::size_t slash_pos = assert_fraction.find('/');
+    if (slash_pos == std::string_view::npos ||
+        !simd::parse_uint_simd(assert_fraction.data(), assert_fraction.data() + slash_pos, module->assert_coverage.covered) ||
+        !simd::parse_uint_simd(assert_fraction.data() + slash_pos + 1, assert_fraction.data() + assert_fraction.size(), module->assert_coverage.expected)) {
+        return ParserResult::ERROR_PARSE_FAILED;
+    }
+    module->assert_coverage.is_valid = true;
+    
+    module->module_name = db.intern(fields[3]);
+    
+    // At least one instance exists if it's in the report
+    module->instance_count = 1;
+    module->covered_instances = module->assert_coverage.covered > 0 ? 1 : 0;
+    
+    return ParserResult::SUCCESS;
+}
+
+// ============================================================================
+// High-Performance Dashboard Parser Implementation
+// ============================================================================
+
+namespace {
+
+// Next line of the mapping without its terminator; false at end of data
+inline bool next_line(const char*& current, const char* end, std::string_view& line) {
+    if (current >= end) {
+        return false;
+    }
+    const char* newline = simd::find_char_simd(current, end - current, '\n');
+    const char* line_end = newline ? newline : end;
+    line = std::string_view(current, line_end - current);
+    current = newline ? newline + 1 : end;
+    return true;
+}
+
+// Value after a "Key:" prefix with surrounding blanks removed
+inline std::string trimmed_value(std::string_view line, std::size_t prefix_length) {
+    return std::string(tokenizer::trim(line.substr(prefix_length)));
+}
+
+} // anonymous namespace
+
+ParserResult HighPerformanceDashboardParser::parse(const std::string& filename, CoverageDatabase& db) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    
+    // Reset stats
+    stats_ = HighPerformanceGroupsParser::PerformanceStats{};
+    stats_.threads_used = 1;
+    
+    // Memory map the file
+    MemoryMappedFile file(filename);
+    if (!file.is_valid()) {
+        return ParserResult::ERROR_FILE_NOT_FOUND;
+    }
+    
+    stats_.file_size_bytes = file.size();
+    
+    auto dashboard_data = std::make_unique<DashboardData>();
+    const char* current = file.data();
+    const char* end = current + file.size();
+    std::string_view line;
+    
+    // Metadata lines up to the "Total Coverage Summary" section
+    bool found_summary_section = false;
+    while (next_line(current, end, line)) {
+        stats_.lines_processed++;
+        if (line.find("Total Coverage Summary") != std::string_view::npos) {
+            found_summary_section = true;
+            break;
+        }
+        parse_metadata_line(line, *dashboard_data);
+    }
+    
+    // Column header, then the summary data line. Like DashboardParser, a
+    // malformed summary leaves the fields parsed so far and is not fatal.
+    if (found_summary_section && next_line(current, end, line) && next_line(current, end, line)) {
+        stats_.lines_processed += 2;
+        parse_summary_line(line, *dashboard_data);
+    }
+    
+    // Count instances in the "Hierarchical coverage data" section
+    bool found_hierarchy_section = false;
+    while (next_line(current, end, line)) {
+        stats_.lines_processed++;
+        if (line.find("Hierarchical coverage data") != std::string_view::npos) {
+            found_hierarchy_section = true;
+            break;
+        }
+    }
+    
+    std::uint32_t instance_count = 0;
+    if (found_hierarchy_section && next_line(current, end, line)) { // Skip column header
+        stats_.lines_processed++;
+        while (next_line(current, end, line)) {
+            stats_.lines_processed++;
+            if (line.empty()) {
+                continue;
+            }
+            if (line_classifier::is_dashboard_instance_line(line)) {
+                instance_count++;
+            }
+            
+            // Stop if we reach another section
+            if (line.find("---") != std::string_view::npos ||
+                line.find("Total") != std::string_view::npos) {
+                break;
+            }
+        }
+    }
+    dashboard_data->num_hierarchical_instances = instance_count;
+    
+    // Store parsed data in database (basic data even if parsing was partial)
+    db.dashboard_data = std::move(dashboard_data);
+    db.is_valid = true;
+    
+    // Calculate performance metrics
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
+    
+    stats_.parse_time_seconds = duration.count() / 1000000.0;
+    stats_.groups_parsed = instance_count;
+    stats_.throughput_mb_per_sec = stats_.parse_time_seconds > 0.0 ?
+        (stats_.file_size_bytes / (1024.0 * 1024.0)) / stats_.parse_time_seconds : 0.0;
+    
+    return ParserResult::SUCCESS;
+}
+
+void HighPerformanceDashboardParser::parse_metadata_line(std::string_view line, DashboardData& dashboard) {
+    if (line.compare(0, 5, "Date:") == 0) {
+        dashboard.date = trimmed_value(line, 5);
+        
+        // Convert to time_point
+        std::tm tm = {};
+        std::istringstream ss(dashboard.date);
+        ss >> std::get_time(&tm, "%a %b %d %H:%M:%S %Y");
+        if (!ss.fail()) {
+            dashboard.generation_time = std::chrono::system_clock::from_time_t(std::mktime(&tm));
+        }
+    } else if (line.compare(0, 5, "User:") == 0) {
+        dashboard.user = trimmed_value(line, 5);
+    } else if (line.compare(0, 8, "Version:") == 0) {
+        dashboard.version = trimmed_value(line, 8);
+    } else if (line.compare(0, 13, "Command line:") == 0) {
+        dashboard.command_line = trimmed_value(line, 13);
+    }
+}
+
+ParserResult HighPerformanceDashboardParser::parse_summary_line(std::string_view line, DashboardData& dashboard) {
+    std::size_t pos = 0;
+    
+    // SCORE  ASSERT_SCORE ASSERT_FRACTION  GROUP_SCORE GROUP_FRACTION
+    std::string_view total_score = tokenizer::next_field(line, pos);
+    std::string_view assert_score = tokenizer::next_field(line, pos);
+    std::string_view assert_fraction = tokenizer::next_field(line, pos);
+    std::string_view group_score = tokenizer::next_field(line, pos);
+    std::string_view group_fraction = tokenizer::next_field(line, pos);
+    
+    if (group_score.empty()) {
+        return ParserResult::SUCCESS; // Not enough fields, nothing to record
+    }
+    
+    if (!simd::parse_double_simd(total_score.data(), total_score.data() + total_score.size(), dashboard.total_score) ||
+        !simd::parse_double_simd(assert_score.data(), assert_score.data() + assert_score.size(), dashboard.assert_coverage.score)) {
+        return ParserResult::ERROR_PARSE_FAILED;
+    }
+    
+    std::size_t slash_pos = assert_fraction.find('/');
+    if (slash_pos != std::string_view::npos) {
+        if (!simd::parse_uint_simd(assert_fraction.data(), assert_fraction.data() + slash_pos, dashboard.assert_coverage.covered) ||
+            !simd::parse_uint_simd(assert_fraction.data() + slash_pos + 1, assert_fraction.data() + assert_fraction.size(), dashboard.assert_coverage.expected)) {
+            return ParserResult::ERROR_PARSE_FAILED;
+        }
+        dashboard.assert_coverage.is_valid = true;
+    }
+    
+    if (!simd::parse_double_simd(group_score.data(), group_score.data() + group_score.size(), dashboard.group_coverage.score)) {
+        return ParserResult::ERROR_PARSE_FAILED;
+    }
+    
+    slash_pos = group_fraction.find('/');
+    if (slash_pos != std::string_view::npos) {
+        if (!simd::parse_uint_simd(group_fraction.data(), group_fraction.data() + slash_pos, dashboard.group_coverage.covered) ||
+            !simd::parse_uint_simd(group_fraction.data() + slash_pos + 1, group_fraction.data() + group_fraction.size(), dashboard.group_coverage.expected)) {
+            return ParserResult::ERROR_PARSE_FAILED;
+        }
+        dashboard.group_coverage.is_valid = true;
+    }
+    
+    return ParserResult::SUCCESS;
 }
 
 // ============================================================================
@@ -598,12 +2065,9 @@ std::vector<std::string_view> HighPerformanceGroupsParser::tokenize_line_simd(st
 
 std::unique_ptr<GroupsParser> PerformanceParserFactory::create_groups_parser(const std::string& filename) {
     // Check file size to determine if optimization is worthwhile
-    std::ifstream file(filename, std::ios::binary | std::ios::ate);
-    if (!file.is_open()) {
-        return std::make_unique<GroupsParser>(); // Fallback to standard parser
-    }
-    
-    std::size_t file_size = static_cast<std::size_t>(file.tellg());
+    // (missing files report size 0 and fall back to the standard parser;
+    // compressed files are sized by their decompressed text)
+    std::size_t file_size = report_content_size(filename);
     
     if (file_size >= OPTIMIZATION_THRESHOLD) {
         // Use high-performance parser for large files
@@ -614,5 +2078,41 @@ std::unique_ptr<GroupsParser> PerformanceParserFactory::create_groups_parser(con
     }
 }
 
+std::unique_ptr<HierarchyParser> PerformanceParserFactory::create_hierarchy_parser(const std::string& filename) {
+    std::size_t file_size = report_content_size(filename);
+    
+    if (file_size >= OPTIMIZATION_THRESHOLD) {
+        // Use high-performance parser for large files
+        return std::make_unique<HighPerformanceHierarchyParser>();
+    } else {
+        // Use standard parser for small files
+        return std::make_unique<HierarchyParser>();
+    }
+}
+
+std::unique_ptr<AssertParser> PerformanceParserFactory::create_assert_parser(const std::string& filename) {
+    std::size_t file_size = report_content_size(filename);
+    
+    if (file_size >= OPTIMIZATION_THRESHOLD) {
+        // Use high-performance parser for large files
+        return std::make_unique<HighPerformanceAssertParser>();
+    } else {
+        // Use standard parser for small files
+        return std::make_unique<AssertParser>();
+    }
+}
+
+std::unique_ptr<ModuleListParser> PerformanceParserFactory::create_modlist_parser(const std::string& filename) {
+    std::size_t file_size = report_content_size(filename);
+    
+    if (file_size >= OPTIMIZATION_THRESHOLD) {
+        // Use high-performance parser for large files
+        return std::make_unique<HighPerformanceModuleListParser>();
+    } else {
+        // Use standard parser for small files
+        return std::make_unique<ModuleListParser>();
+    }
+}
+
 } // namespace performance
 } // namespace coverage_parser
\ No newline at end of file
@@ -0,0 +1,240 @@
+/**
+ * @file line_classifier.cpp
+ * @brief Implementation of the regex-free data line classifiers
+ *
+ * Every pattern the parsers used is anchored (regex_match) and built from
+ * disjoint character classes, so the regex engine never has a real choice to
+ * make until the trailing ".+" / ".*" part. The scanners below therefore walk
+ * the fixed prefix greedily and only reason about the tail:
+ *
+ * - "\s+.+" at the end of a line: the whitespace run may swallow line breaks,
+ *   so every '\n' / '\r' must lie inside the leading whitespace run and at
+ *   least one character must follow the last of them.
+ * - ".*" / ".+" elsewhere: the remainder must be free of line breaks.
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#include "line_classifier.h"
+
+namespace coverage_parser {
+namespace line_classifier {
+
+namespace {
+
+inline bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+inline bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+inline bool is_word(char c) {
+    return is_digit(c) || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+inline bool is_line_break(char c) {
+    return c == '\n' || c == '\r';
+}
+
+/**
+ * @brief Forward-only cursor over a line
+ */
+class Scanner {
+public:
+    explicit Scanner(std::string_view line)
+        : current_(line.data()), end_(line.data() + line.size()) {}
+
+    // \s*
+    void skip_spaces() {
+        while (current_ < end_ && is_space(*current_)) {
+            ++current_;
+        }
+    }
+
+    // \s+
+    bool spaces() {
+        const char* begin = current_;
+        skip_spaces();
+        return current_ > begin;
+    }
+
+    // \d+
+    bool digits() {
+        const char* begin = current_;
+        while (current_ < end_ && is_digit(*current_)) {
+            ++current_;
+        }
+        return current_ > begin;
+    }
+
+    // Single literal character
+    bool literal(char c) {
+        if (current_ < end_ && *current_ == c) {
+            ++current_;
+            return true;
+        }
+        return false;
+    }
+
+    // Literal word
+    bool keyword(std::string_view word) {
+        if (static_cast<std::size_t>(end_ - current_) >= word.size() &&
+            std::string_view(current_, word.size()) == word) {
+            current_ += word.size();
+            return true;
+        }
+        return false;
+    }
+
+    // \d+\.\d+
+    bool decimal() {
+        return digits() && literal('.') && digits();
+    }
+
+    // \d+/\d+
+    bool fraction() {
+        return digits() && literal('/') && digits();
+    }
+
+    // .* to the end of the line
+    bool rest_has_no_line_break() const {
+        for (const char* p = current_; p < end_; ++p) {
+            if (is_line_break(*p)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // \s+.+ to the end of the line
+    bool spaces_then_text() const {
+        if (current_ == end_ || !is_space(*current_)) {
+            return false;
+        }
+
+        // Leading whitespace run and the last line break anywhere in the tail
+        const char* run_end = current_;
+        while (run_end < end_ && is_space(*run_end)) {
+            ++run_end;
+        }
+        const char* last_break = nullptr;
+        for (const char* p = current_; p < end_; ++p) {
+            if (is_line_break(*p)) {
+                last_break = p;
+            }
+        }
+
+        // \s+ has to end after the last break (and after at least one char),
+        // while .+ still needs one character to match
+        const char* split = last_break ? last_break + 1 : current_ + 1;
+        if (last_break && last_break >= run_end) {
+            return false;
+        }
+        return split < end_;
+    }
+
+    bool at_end() const { return current_ == end_; }
+    char peek() const { return *current_; }
+    const char* position() const { return current_; }
+    const char* end() const { return end_; }
+
+private:
+    const char* current_;
+    const char* end_;
+};
+
+// \s*\d+\.\d+\s+\d+\.\d+\s+\d+/\d+ shared by hierarchy, modlist and dashboard lines
+inline bool scan_score_prefix(Scanner& scanner) {
+    scanner.skip_spaces();
+    return scanner.decimal() && scanner.spaces() &&
+           scanner.decimal() && scanner.spaces() &&
+           scanner.fraction();
+}
+
+} // anonymous namespace
+
+bool is_group_data_line(std::string_view line) noexcept {
+    Scanner scanner(line);
+    scanner.skip_spaces();
+    if (!scanner.digits() || !scanner.spaces() || !scanner.digits() || !scanner.spaces()) {
+        return false;
+    }
+
+    // [\d\-\.]+.*
+    if (scanner.at_end()) {
+        return false;
+    }
+    char c = scanner.peek();
+    if (!is_digit(c) && c != '-' && c != '.') {
+        return false;
+    }
+    return scanner.rest_has_no_line_break();
+}
+
+bool is_hierarchy_data_line(std::string_view line) noexcept {
+    Scanner scanner(line);
+    return scan_score_prefix(scanner) && scanner.spaces_then_text();
+}
+
+bool is_module_data_line(std::string_view line) noexcept {
+    return is_hierarchy_data_line(line);
+}
+
+bool is_dashboard_instance_line(std::string_view line) noexcept {
+    Scanner scanner(line);
+
+    // The fraction's \d+ keeps only its first digit when the line is just
+    // digits, so ".*\w+" needs at least one character after that digit
+    scanner.skip_spaces();
+    if (!scanner.decimal() || !scanner.spaces() || !scanner.decimal() || !scanner.spaces() ||
+        !scanner.digits() || !scanner.literal('/')) {
+        return false;
+    }
+    const char* first_digit = scanner.position();
+    if (!scanner.digits() || scanner.end() - first_digit < 2) {
+        return false;
+    }
+
+    Scanner tail(std::string_view(first_digit, scanner.end() - first_digit));
+    return tail.rest_has_no_line_break() && is_word(*(scanner.end() - 1));
+}
+
+bool is_assert_status_line(std::string_view line) noexcept {
+    Scanner scanner(line);
+    scanner.skip_spaces();
+    if (!scanner.keyword("PASS") && !scanner.keyword("FAIL") &&
+        !scanner.keyword("COVERED") && !scanner.keyword("UNCOVERED")) {
+        return false;
+    }
+    return scanner.spaces() && scanner.digits() && scanner.spaces_then_text();
+}
+
+bool is_assert_fraction_line(std::string_view line) noexcept {
+    Scanner scanner(line);
+    scanner.skip_spaces();
+    return scanner.fraction() && scanner.spaces_then_text();
+}
+
+bool is_assert_general_line(std::string_view line) noexcept {
+    Scanner scanner(line);
+    scanner.skip_spaces();
+    if (scanner.at_end() || !is_word(scanner.peek()) || !scanner.rest_has_no_line_break()) {
+        return false;
+    }
+
+    // \w+.*\w+.*\w+ needs three word characters, in any positions
+    int word_chars = 0;
+    for (const char* p = scanner.position(); p < scanner.end() && word_chars < 3; ++p) {
+        if (is_word(*p)) {
+            ++word_chars;
+        }
+    }
+    return word_chars >= 3;
+}
+
+} // namespace line_classifier
+} // namespace coverage_parser
@@ -0,0 +1,359 @@
+/**
+ * @file memory_pool.cpp
+ * @brief Implementation of the thread-local bump arena
+ *
+ * Chunk lists are Treiber stacks linked through a header at the start of each
+ * chunk. While threads allocate, the free list is only ever popped (pushes
+ * happen in reset(), which must not overlap allocation), so a chunk cannot
+ * reappear at the head under a concurrent pop and the stack is ABA-free.
+ *
+ * A thread caches cursors for a few pools. A thread that allocates from more
+ * pools at once bumps the pool's shared chunk atomically instead of evicting
+ * a cursor that is still in use. Only a cold cursor is evicted, and the
+ * unused rest of its chunk goes back to its pool if the pool still exists.
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#include "memory_pool.h"
+#include "flat_hash_map.h"
+#include <algorithm>
+#include <cstdlib>
+#include <mutex>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace coverage_parser {
+namespace performance {
+
+namespace {
+
+// 64-byte aligned chunk allocation (cache line / AVX-512 register width)
+void* aligned_chunk_alloc(std::size_t size) {
+#ifdef _WIN32
+    return _aligned_malloc(size, 64);
+#else
+    void* memory = nullptr;
+    return posix_memalign(&memory, 64, size) == 0 ? memory : nullptr;
+#endif
+}
+
+void aligned_chunk_free(void* memory) {
+#ifdef _WIN32
+    _aligned_free(memory);
+#else
+    free(memory);
+#endif
+}
+
+/**
+ * @brief A thread's bump cursor into one pool's chunk
+ *
+ * Each thread caches cursors for a few pools, so a worker that alternates
+ * between the chunks of two parses does not throw its chunk away each time.
+ */
+struct ThreadCursor {
+    std::uint64_t pool_id = 0;
+    std::uint64_t generation = 0;
+    std::uint64_t last_used = 0;  // allocation_tick of the last allocation through it
+    void* chunk = nullptr;        // MemoryPool::Chunk the cursor points into
+    char* cursor = nullptr;
+    char* limit = nullptr;
+};
+
+constexpr std::size_t THREAD_CURSORS = 4;
+
+// A cursor idle for this many of its thread's allocations may be evicted
+constexpr std::uint64_t COLD_CURSOR_TICKS = 1024;
+
+thread_local ThreadCursor thread_cursors[THREAD_CURSORS];
+thread_local std::uint64_t allocation_tick = 0;
+
+std::atomic<std::uint64_t> next_pool_id{1};
+
+/**
+ * @brief Live pools by id
+ *
+ * A thread evicting a cursor only knows its pool's id, and the pool may be
+ * gone. The registry lock keeps the pool alive (and reset() out) while the
+ * cursor's tail is handed back.
+ */
+struct PoolRegistry {
+    std::mutex mutex;
+    FlatHashMap<std::uint64_t, MemoryPool*> pools;
+};
+
+PoolRegistry& pool_registry() {
+    static PoolRegistry* registry = new PoolRegistry();  // Outlives pools destroyed at exit
+    return *registry;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Chunk Management
+// ============================================================================
+
+struct MemoryPool::Chunk {
+    std::atomic<Chunk*> next{nullptr};  // Next chunk in the owned or free list
+    std::size_t size = 0;               // Usable bytes after the header
+    std::atomic<std::size_t> used{0};   // Bytes handed out, while this is the shared chunk
+
+    char* data() { return reinterpret_cast<char*>(this) + HEADER_SIZE; }
+};
+
+static_assert(sizeof(std::atomic<void*>) + 2 * sizeof(std::size_t) <= 64, "Chunk header must fit in HEADER_SIZE");
+
+MemoryPool::MemoryPool(std::size_t chunk_size)
+    : chunk_size_(std::max<std::size_t>(chunk_size, 4 * HEADER_SIZE)),
+      pool_id_(next_pool_id.fetch_add(1, std::memory_order_relaxed)) {
+    PoolRegistry& registry = pool_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.pools[pool_id_] = this;
+}
+
+MemoryPool::~MemoryPool() {
+    {
+        PoolRegistry& registry = pool_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.pools.erase(pool_id_);
+    }
+    
+    for (std::atomic<Chunk*>* list : {&chunks_, &free_chunks_}) {
+        Chunk* chunk = list->load(std::memory_order_acquire);
+        while (chunk) {
+            Chunk* next = chunk->next.load(std::memory_order_relaxed);
+            chunk->~Chunk();
+            aligned_chunk_free(chunk);
+            chunk = next;
+        }
+    }
+}
+
+void MemoryPool::push(std::atomic<Chunk*>& list, Chunk* chunk) {
+    Chunk* head = list.load(std::memory_order_relaxed);
+    do {
+        chunk->next.store(head, std::memory_order_relaxed);
+    } while (!list.compare_exchange_weak(head, chunk, std::memory_order_release, std::memory_order_relaxed));
+}
+
+MemoryPool::Chunk* MemoryPool::acquire_chunk(std::size_t min_size) {
+    // Recycled chunks all have the standard size
+    if (min_size <= chunk_size_) {
+        Chunk* chunk = free_chunks_.load(std::memory_order_acquire);
+        while (chunk && !free_chunks_.compare_exchange_weak(
+                   chunk, chunk->next.load(std::memory_order_relaxed),
+                   std::memory_order_acquire, std::memory_order_acquire)) {
+        }
+        if (chunk) {
+            push(chunks_, chunk);
+            return chunk;
+        }
+    }
+
+    const std::size_t size = std::max(min_size, chunk_size_);
+    void* memory = aligned_chunk_alloc(HEADER_SIZE + size);
+    if (!memory) {
+        return nullptr;
+    }
+
+    Chunk* chunk = new (memory) Chunk();
+    chunk->size = size;
+    total_allocated_.fetch_add(HEADER_SIZE + size, std::memory_order_relaxed);
+    chunks_count_.fetch_add(1, std::memory_order_relaxed);
+    push(chunks_, chunk);
+    return chunk;
+}
+
+// ============================================================================
+// Allocation
+// ============================================================================
+
+void* MemoryPool::allocate(std::size_t size, std::size_t alignment) {
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0 || alignment > HEADER_SIZE) {
+        return nullptr;
+    }
+    size = std::max<std::size_t>(size, 1);
+
+    // Large requests get a dedicated chunk (data is 64-byte aligned)
+    if (size > chunk_size_ / 4) {
+        Chunk* chunk = acquire_chunk(size);
+        return chunk ? chunk->data() : nullptr;
+    }
+
+    const std::uint64_t generation = generation_.load(std::memory_order_acquire);
+    const std::uint64_t tick = ++allocation_tick;
+    ThreadCursor* slot = nullptr;
+    for (ThreadCursor& candidate : thread_cursors) {
+        if (candidate.pool_id == pool_id_) {
+            slot = &candidate;
+            break;
+        }
+    }
+
+    // Fast path: bump the cursor within this thread's chunk
+    if (slot && slot->generation == generation) {
+        std::uintptr_t address = reinterpret_cast<std::uintptr_t>(slot->cursor);
+        std::uintptr_t aligned = (address + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+        std::uintptr_t limit = reinterpret_cast<std::uintptr_t>(slot->limit);
+        if (aligned <= limit && limit - aligned >= size) {
+            slot->cursor = reinterpret_cast<char*>(aligned + size);
+            slot->last_used = tick;
+            return reinterpret_cast<void*>(aligned);
+        }
+    }
+
+    // No cursor for this pool: take a free or cold slot, else share
+    if (!slot) {
+        ThreadCursor* oldest = &thread_cursors[0];
+        for (ThreadCursor& candidate : thread_cursors) {
+            if (candidate.last_used < oldest->last_used) {
+                oldest = &candidate;
+            }
+        }
+        if (oldest->pool_id != 0 && tick - oldest->last_used < COLD_CURSOR_TICKS) {
+            return allocate_shared(size, alignment);
+        }
+        if (oldest->pool_id != 0) {
+            return_tail(oldest->pool_id, oldest->generation, oldest->chunk, oldest->cursor);
+        }
+        slot = oldest;
+    }
+
+    // Refill the cursor: the rest of the shared chunk if that is large, else a new chunk
+    char* cursor = nullptr;
+    Chunk* chunk = take_shared_tail(cursor);
+    if (!chunk) {
+        chunk = acquire_chunk(chunk_size_);
+        if (!chunk) {
+            return nullptr;
+        }
+        cursor = chunk->data();
+    }
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(cursor);
+    char* aligned = reinterpret_cast<char*>((address + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1));
+    slot->pool_id = pool_id_;
+    slot->generation = generation;
+    slot->last_used = tick;
+    slot->chunk = chunk;
+    slot->cursor = aligned + size;
+    slot->limit = chunk->data() + chunk->size;
+    return aligned;
+}
+
+void* MemoryPool::allocate_shared(std::size_t size, std::size_t alignment) {
+    Chunk* chunk = shared_chunk_.load(std::memory_order_acquire);
+    if (chunk) {
+        std::size_t used = chunk->used.load(std::memory_order_relaxed);
+        for (;;) {
+            const std::size_t offset = (used + alignment - 1) & ~(alignment - 1);  // data() is 64-byte aligned
+            if (offset > chunk->size || chunk->size - offset < size) {
+                break;
+            }
+            if (chunk->used.compare_exchange_weak(used, offset + size, std::memory_order_relaxed)) {
+                return chunk->data() + offset;
+            }
+        }
+    }
+
+    // Exhausted: publish a new shared chunk. A thread that loses the race to
+    // publish keeps its allocation and leaves the rest of its chunk unused.
+    Chunk* fresh = acquire_chunk(chunk_size_);
+    if (!fresh) {
+        return nullptr;
+    }
+    fresh->used.store(size, std::memory_order_relaxed);
+    shared_chunk_.compare_exchange_strong(chunk, fresh, std::memory_order_release, std::memory_order_relaxed);
+    return fresh->data();
+}
+
+MemoryPool::Chunk* MemoryPool::take_shared_tail(char*& cursor) {
+    Chunk* chunk = shared_chunk_.load(std::memory_order_acquire);
+    if (!chunk) {
+        return nullptr;
+    }
+    std::size_t used = chunk->used.load(std::memory_order_relaxed);
+    while (used <= chunk->size && chunk->size - used >= chunk_size_ / 2) {
+        if (chunk->used.compare_exchange_weak(used, chunk->size, std::memory_order_relaxed)) {
+            cursor = chunk->data() + used;
+            return chunk;
+        }
+    }
+    return nullptr;
+}
+
+void MemoryPool::return_tail(std::uint64_t pool_id, std::uint64_t generation, void* chunk_memory, char* cursor) {
+    PoolRegistry& registry = pool_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto it = registry.pools.find(pool_id);
+    if (it == registry.pools.end()) {
+        return;  // Pool destroyed, its chunks with it
+    }
+    MemoryPool& pool = *it->second;
+    if (pool.generation_.load(std::memory_order_relaxed) != generation) {
+        return;  // Pool reset since: the chunk was recycled
+    }
+
+    // The tail becomes the shared chunk if it has more room than the current one
+    Chunk* chunk = static_cast<Chunk*>(chunk_memory);
+    const std::size_t tail_used = std::min<std::size_t>(cursor - chunk->data(), chunk->size);
+    Chunk* current = pool.shared_chunk_.load(std::memory_order_acquire);
+    const std::size_t current_free = current ? current->size - std::min(current->used.load(std::memory_order_relaxed), current->size) : 0;
+    if (chunk->size - tail_used > current_free) {
+        chunk->used.store(tail_used, std::memory_order_relaxed);
+        pool.shared_chunk_.compare_exchange_strong(current, chunk, std::memory_order_release, std::memory_order_relaxed);
+    }
+}
+
+bool MemoryPool::reserve(std::size_t bytes) {
+    std::size_t free_count = 0;
+    for (Chunk* chunk = free_chunks_.load(std::memory_order_acquire); chunk;
+         chunk = chunk->next.load(std::memory_order_relaxed)) {
+        free_count++;
+    }
+    
+    const std::size_t needed = (bytes + chunk_size_ - 1) / chunk_size_;
+    for (; free_count < needed; ++free_count) {
+        void* memory = aligned_chunk_alloc(HEADER_SIZE + chunk_size_);
+        if (!memory) {
+            return false;
+        }
+        Chunk* chunk = new (memory) Chunk();
+        chunk->size = chunk_size_;
+        total_allocated_.fetch_add(HEADER_SIZE + chunk_size_, std::memory_order_relaxed);
+        chunks_count_.fetch_add(1, std::memory_order_relaxed);
+        push(free_chunks_, chunk);
+    }
+    return true;
+}
+
+void MemoryPool::reset() {
+    // Excludes a concurrent return_tail() into chunks about to be recycled
+    PoolRegistry& registry = pool_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    shared_chunk_.store(nullptr, std::memory_order_relaxed);
+    
+    // Standard chunks go back to the free list, dedicated ones are released
+    Chunk* chunk = chunks_.exchange(nullptr, std::memory_order_acquire);
+    while (chunk) {
+        Chunk* next = chunk->next.load(std::memory_order_relaxed);
+        if (chunk->size == chunk_size_) {
+            push(free_chunks_, chunk);
+        } else {
+            total_allocated_.fetch_sub(HEADER_SIZE + chunk->size, std::memory_order_relaxed);
+            chunks_count_.fetch_sub(1, std::memory_order_relaxed);
+            chunk->~Chunk();
+            aligned_chunk_free(chunk);
+        }
+        chunk = next;
+    }
+
+    // Invalidates every thread's cursor into the recycled chunks
+    generation_.fetch_add(1, std::memory_order_release);
+}
+
+} // namespace performance
+} // namespace coverage_parser
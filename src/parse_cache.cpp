@@ -0,0 +1,214 @@
+/**
+ * @file parse_cache.cpp
+ * @brief Implementation of the parse cache
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#include "../include/parse_cache.h"
+#include "../include/high_performance_parser.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <system_error>
+#include <thread>
+
+namespace coverage_parser {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr std::uint64_t FULL_HASH_LIMIT = 1u << 20;   // Hash smaller files in full
+constexpr std::uint64_t SAMPLE_BLOCK = 64u << 10;
+constexpr std::uint64_t SAMPLE_COUNT = 16;
+
+// Entry names are variant-keyhash.fcsnap; keep the variant a plain file name
+std::string file_name_part(std::string_view variant) {
+    std::string part(variant);
+    std::replace_if(part.begin(), part.end(), [](char c) {
+        return !((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '-');
+    }, '_');
+    return part;
+}
+
+// Unique per process, thread and call: concurrent stores of one entry
+// never write the same temporary file
+std::string temporary_path(const std::string& entry) {
+    static std::atomic<std::uint64_t> counter{0};
+    const std::uint64_t unique =
+        static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()) ^
+        (static_cast<std::uint64_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())) << 16) ^
+        counter.fetch_add(1, std::memory_order_relaxed);
+    char suffix[32];
+    std::snprintf(suffix, sizeof(suffix), ".%016llx.tmp", static_cast<unsigned long long>(unique));
+    return entry + suffix;
+}
+
+// Move a written entry into place; a concurrent store of the same entry
+// wrote the same contents, so whichever rename lands last is fine
+void publish(const std::string& temporary, const std::string& entry) {
+    std::error_code error;
+    fs::rename(temporary, entry, error);
+    if (error) {
+        fs::remove(temporary, error);
+    }
+}
+
+bool holds_records(const CoverageDatabase& db) {
+    return db.dashboard_data || db.get_num_groups() != 0 || db.get_num_hierarchy_instances() != 0 ||
+           db.get_num_modules() != 0 || db.get_num_asserts() != 0 || db.is_ingesting();
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Cache Keys
+// ============================================================================
+
+ParseCache::ParseCache(std::string directory)
+    : directory_(std::move(directory)) {
+}
+
+bool ParseCache::compute_key(const std::string& filename, ParseCacheKey& key) {
+    std::error_code error;
+    const std::uintmax_t size = fs::file_size(filename, error);
+    if (error) {
+        return false;
+    }
+    const fs::file_time_type modified = fs::last_write_time(filename, error);
+    if (error) {
+        return false;
+    }
+    key.file_size = size;
+    key.modified_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(modified.time_since_epoch()).count();
+
+    if (size == 0) {
+        key.content_hash = snapshot::checksum(nullptr, 0);
+        return true;
+    }
+
+    // Sampled blocks are mapped, so only their pages are read
+    performance::MemoryMappedFile file(filename, performance::MemoryMappedFile::Access::RANDOM);
+    if (!file.is_valid()) {
+        return false;
+    }
+    if (file.size() <= FULL_HASH_LIMIT) {
+        key.content_hash = snapshot::checksum(file.data(), file.size());
+        return true;
+    }
+    std::uint64_t block_hashes[SAMPLE_COUNT];
+    const std::uint64_t last_block = file.size() - SAMPLE_BLOCK;
+    for (std::uint64_t i = 0; i < SAMPLE_COUNT; ++i) {
+        block_hashes[i] = snapshot::checksum(file.data() + last_block * i / (SAMPLE_COUNT - 1), SAMPLE_BLOCK);
+    }
+    key.content_hash = snapshot::checksum(block_hashes, sizeof(block_hashes));
+    return true;
+}
+
+std::string ParseCache::entry_path(const ParseCacheKey& key, std::string_view variant) const {
+    // The format version is part of the key: entries of an older format are
+    // never looked up again, rather than being rejected on every open
+    const std::uint64_t fields[] = {key.file_size, static_cast<std::uint64_t>(key.modified_ns), key.content_hash,
+                                    snapshot::FORMAT_VERSION, snapshot::name_hash(variant)};
+    char hash[24];
+    std::snprintf(hash, sizeof(hash), "%016llx",
+                  static_cast<unsigned long long>(snapshot::checksum(fields, sizeof(fields))));
+    return (fs::path(directory_) / (file_name_part(variant) + "-" + hash + ".fcsnap")).string();
+}
+
+// ============================================================================
+// Cached Parsing
+// ============================================================================
+
+ParserResult ParseCache::parse(const std::string& filename, std::string_view variant, CoverageDatabase& db,
+                               const ParseFunction& parse_file) {
+    ParseCacheKey key;
+    if (!compute_key(filename, key)) {
+        return parse_file(filename, db);  // Let the parser report the unreadable file
+    }
+    const std::string entry = entry_path(key, variant);
+
+    // A failed merge leaves db as it was, so parsing into it is still safe
+    if (merge_snapshot(entry, db) == ParserResult::SUCCESS) {
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        return ParserResult::SUCCESS;
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+
+    std::error_code error;
+    fs::create_directories(directory_, error);
+    if (error) {
+        return parse_file(filename, db);
+    }
+    const std::string temporary = temporary_path(entry);
+
+    if (!holds_records(db)) {
+        ParserResult result = parse_file(filename, db);
+        if (result == ParserResult::SUCCESS) {
+            if (write_snapshot(db, temporary) == ParserResult::SUCCESS) {
+                publish(temporary, entry);
+            } else {
+                fs::remove(temporary, error);
+            }
+        }
+        return result;
+    }
+
+    // The entry must hold only this report: parse it on its own, then add
+    // it to db through the entry just written
+    CoverageDatabase scratch(db.storage_mode());
+    ParserResult result = parse_file(filename, scratch);
+    if (result != ParserResult::SUCCESS) {
+        return result;
+    }
+    if (write_snapshot(scratch, temporary) != ParserResult::SUCCESS) {
+        fs::remove(temporary, error);
+        return parse_file(filename, db);
+    }
+    scratch.reset();
+    result = merge_snapshot(temporary, db);
+    publish(temporary, entry);
+    return result;
+}
+
+ParserResult ParseCache::open(const std::string& filename, std::string_view variant, SnapshotReader& reader,
+                              const ParseFunction& parse_file) {
+    reader.close();
+    ParseCacheKey key;
+    if (!compute_key(filename, key)) {
+        return ParserResult::ERROR_FILE_NOT_FOUND;
+    }
+    const std::string entry = entry_path(key, variant);
+
+    if (reader.open(entry, true) == ParserResult::SUCCESS) {
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        return ParserResult::SUCCESS;
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+
+    CoverageDatabase scratch;
+    ParserResult result = parse_file(filename, scratch);
+    if (result != ParserResult::SUCCESS) {
+        return result;
+    }
+    std::error_code error;
+    fs::create_directories(directory_, error);
+    if (error) {
+        return ParserResult::ERROR_FILE_NOT_FOUND;
+    }
+    const std::string temporary = temporary_path(entry);
+    result = write_snapshot(scratch, temporary);
+    if (result != ParserResult::SUCCESS) {
+        fs::remove(temporary, error);
+        return result;
+    }
+    scratch.reset();
+    publish(temporary, entry);
+    return reader.open(entry, false);  // Just written: skip the checksum pass
+}
+
+} // namespace coverage_parser
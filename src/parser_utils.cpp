@@ -24,6 +24,7 @@
 
 #include "functional_coverage_parser.h"
 #include <sstream>
+#include <charconv>
 #include <algorithm>
 #include <regex>
 #include <iomanip>
@@ -93,12 +94,10 @@ std::vector<std::string> split(const std::string& str, char delimiter) {
  */
 std::vector<std::string> split_whitespace(const std::string& str) {
     std::vector<std::string> tokens;
-    std::istringstream iss(str);
-    std::string token;
     
-    while (iss >> token) {
-        tokens.push_back(token);
-    }
+    tokenizer::for_each_field(str, [&tokens](std::string_view field) {
+        tokens.emplace_back(field);
+    });
     
     return tokens;
 }
@@ -173,6 +172,131 @@ std::size_t get_file_size(const std::string& filename) {
     return static_cast<std::size_t>(file.tellg());
 }
 
+std::size_t expected_record_count(std::uint32_t declared_total, std::size_t file_bytes,
+                                  std::size_t typical_line_bytes, std::uint32_t limit) noexcept {
+    std::size_t count = declared_total > 0 ?
+        std::min<std::size_t>(declared_total, file_bytes / MIN_RECORD_LINE_BYTES + 1) :
+        file_bytes / typical_line_bytes;
+    if (limit > 0) {
+        count = std::min<std::size_t>(count, limit);
+    }
+    return count;
+}
+
+namespace {
+
+// Shared std::from_chars front end: optional '+', whole field must be consumed
+template <typename T>
+bool parse_number(std::string_view text, T& value) noexcept {
+    if (!text.empty() && text.front() == '+') {
+        text.remove_prefix(1);
+        if (!text.empty() && text.front() == '-') {
+            return false;
+        }
+    }
+    if (text.empty()) {
+        return false;
+    }
+    
+    T parsed{};
+    const char* end = text.data() + text.size();
+    auto [ptr, ec] = std::from_chars(text.data(), end, parsed);
+    if (ec != std::errc() || ptr != end) {
+        return false;
+    }
+    
+    value = parsed;
+    return true;
+}
+
+} // anonymous namespace
+
+/**
+ * @brief Parse an unsigned integer field without exceptions
+ * 
+ * @param text Field to parse, e.g. "60148"
+ * @param value Receives the parsed value on success
+ * @return true if the whole field is a valid 32-bit unsigned integer
+ */
+bool try_parse_uint(std::string_view text, std::uint32_t& value) noexcept {
+    return parse_number(text, value);
+}
+
+/**
+ * @brief Parse a signed integer field without exceptions
+ * 
+ * @param text Field to parse, e.g. "-456"
+ * @param value Receives the parsed value on success
+ * @return true if the whole field is a valid 32-bit signed integer
+ */
+bool try_parse_int(std::string_view text, std::int32_t& value) noexcept {
+    return parse_number(text, value);
+}
+
+/**
+ * @brief Parse a floating-point field without exceptions
+ * 
+ * @param text Field to parse, e.g. "41.01"
+ * @param value Receives the parsed value on success
+ * @return true if the whole field is a valid floating-point number
+ */
+bool try_parse_double(std::string_view text, double& value) noexcept {
+    return parse_number(text, value);
+}
+
+/**
+ * @brief Parse a "covered/expected" fraction without exceptions
+ * 
+ * @param text Field to parse, e.g. "60148/272087"
+ * @param covered Receives the numerator on success
+ * @param expected Receives the denominator on success
+ * @return true if both sides of the '/' are valid unsigned integers
+ */
+bool try_parse_fraction(std::string_view text, std::uint32_t& covered, std::uint32_t& expected) noexcept {
+    std::size_t slash_pos = text.find('/');
+    if (slash_pos == std::string_view::npos) {
+        return false;
+    }
+    
+    std::uint32_t parsed_covered = 0;
+    std::uint32_t parsed_expected = 0;
+    if (!try_parse_uint(text.substr(0, slash_pos), parsed_covered) ||
+        !try_parse_uint(text.substr(slash_pos + 1), parsed_expected)) {
+        return false;
+    }
+    
+    covered = parsed_covered;
+    expected = parsed_expected;
+    return true;
+}
+
+/**
+ * @brief Parse the record total a report declares in its header
+ * 
+ * Finds @p label in @p line and parses the number that follows it, skipping
+ * the ':' separator and spaces: "Total groups in report: 16295" with label
+ * "Total groups in report" yields 16295.
+ * 
+ * @return true if the label is present and followed by a number
+ */
+bool try_parse_declared_total(std::string_view line, std::string_view label, std::uint32_t& count) noexcept {
+    std::size_t label_pos = line.find(label);
+    if (label.empty() || label_pos == std::string_view::npos) {
+        return false;
+    }
+    
+    std::size_t begin = label_pos + label.size();
+    while (begin < line.size() && (line[begin] == ':' || line[begin] == ' ' || line[begin] == '\t')) {
+        begin++;
+    }
+    std::size_t end = begin;
+    while (end < line.size() && line[end] >= '0' && line[end] <= '9') {
+        end++;
+    }
+    
+    return end > begin && try_parse_uint(line.substr(begin, end - begin), count);
+}
+
 /**
  * @brief Parse a percentage string
  * 
@@ -185,22 +309,16 @@ std::size_t get_file_size(const std::string& filename) {
  * @return Percentage as double (0.0 to 100.0), -1.0 on error
  */
 double parse_percentage(const std::string& percentage_str) {
-    if (percentage_str.empty()) {
-        return -1.0;
-    }
-    
-    std::string clean_str = trim(percentage_str);
+    std::string_view clean_str = tokenizer::trim(percentage_str);
     
     // Remove % symbol if present
-    if (clean_str.back() == '%') {
-        clean_str.pop_back();
+    if (!clean_str.empty() && clean_str.back() == '%') {
+        clean_str.remove_suffix(1);
     }
     
-    try {
-        return std::stod(clean_str);
-    } catch (const std::exception&) {
-        return -1.0;
-    }
+    double percentage = -1.0;
+    try_parse_double(clean_str, percentage);
+    return percentage;
 }
 
 /**
@@ -213,15 +331,9 @@ double parse_percentage(const std::string& percentage_str) {
  * @return Parsed integer or default value
  */
 std::int32_t parse_int(const std::string& int_str, std::int32_t default_value) {
-    if (int_str.empty()) {
-        return default_value;
-    }
-    
-    try {
-        return std::stoi(trim(int_str));
-    } catch (const std::exception&) {
-        return default_value;
-    }
+    std::int32_t value = default_value;
+    try_parse_int(tokenizer::trim(int_str), value);
+    return value;
 }
 
 /**
@@ -234,15 +346,9 @@ std::int32_t parse_int(const std::string& int_str, std::int32_t default_value) {
  * @return Parsed unsigned integer or default value
  */
 std::uint32_t parse_uint(const std::string& uint_str, std::uint32_t default_value) {
-    if (uint_str.empty()) {
-        return default_value;
-    }
-    
-    try {
-        return std::stoul(trim(uint_str));
-    } catch (const std::exception&) {
-        return default_value;
-    }
+    std::uint32_t value = default_value;
+    try_parse_uint(tokenizer::trim(uint_str), value);
+    return value;
 }
 
 /**
@@ -255,15 +361,9 @@ std::uint32_t parse_uint(const std::string& uint_str, std::uint32_t default_valu
  * @return Parsed double or default value
  */
 double parse_double(const std::string& float_str, double default_value) {
-    if (float_str.empty()) {
-        return default_value;
-    }
-    
-    try {
-        return std::stod(trim(float_str));
-    } catch (const std::exception&) {
-        return default_value;
-    }
+    double value = default_value;
+    try_parse_double(tokenizer::trim(float_str), value);
+    return value;
 }
 
 /**
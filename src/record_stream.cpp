@@ -0,0 +1,426 @@
+/**
+ * @file record_stream.cpp
+ * @brief Implementation of streaming record access
+ *
+ * Holds the line rules of the line-oriented reports: which lines are
+ * headers, which are records and how each record is decoded. The standard
+ * parsers insert what RecordReader yields into a database; stream_report()
+ * hands it to a visitor instead.
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#include "../include/record_stream.h"
+#include "../include/line_classifier.h"
+#include <algorithm>
+
+namespace coverage_parser {
+
+namespace {
+
+bool contains(std::string_view line, std::string_view text) {
+    return line.find(text) != std::string_view::npos;
+}
+
+// Malformed data lines tolerated before a report is rejected
+std::uint32_t error_limit(ReportKind kind) {
+    switch (kind) {
+        case ReportKind::GROUPS:    return 10;
+        case ReportKind::HIERARCHY: return 20;
+        case ReportKind::MODULES:   return 10;
+        case ReportKind::ASSERTS:   return 50;
+    }
+    return 0;
+}
+
+// Records to read before stopping, 0 for unlimited
+std::uint32_t record_limit(ReportKind kind, const ParserConfig& config) {
+    switch (kind) {
+        case ReportKind::GROUPS:    return config.max_groups;
+        case ReportKind::HIERARCHY: return config.max_instances;
+        case ReportKind::MODULES:   return config.max_instances;
+        case ReportKind::ASSERTS:   return 0;
+    }
+    return 0;
+}
+
+bool is_header_line(ReportKind kind, std::string_view line) {
+    switch (kind) {
+        case ReportKind::GROUPS:
+            return contains(line, "Testbench Group List") ||
+                   contains(line, "Total Groups Coverage Summary") ||
+                   contains(line, "Total groups in report") ||
+                   contains(line, "COVERED EXPECTED SCORE") ||
+                   contains(line, "INSTANCES WEIGHT GOAL") ||
+                   contains(line, "NAME");
+        case ReportKind::HIERARCHY:
+            return contains(line, "Design Hierarchy") ||
+                   contains(line, "SCORE") ||
+                   contains(line, "ASSERT") ||
+                   contains(line, "Hierarchical");
+        case ReportKind::MODULES:
+            return contains(line, "Design Module List") ||
+                   contains(line, "Total Module Definition Coverage Summary") ||
+                   contains(line, "Total modules in report") ||
+                   contains(line, "SCORE") ||
+                   contains(line, "ASSERT") ||
+                   contains(line, "NAME");
+        case ReportKind::ASSERTS:
+            return contains(line, "Assertion Coverage Report") ||
+                   contains(line, "Total Assertions") ||
+                   contains(line, "Coverage:") ||
+                   contains(line, "STATUS") ||
+                   contains(line, "HITS") ||
+                   contains(line, "ASSERTION") ||
+                   contains(line, "INSTANCE") ||
+                   contains(line, "FILE:LINE");
+    }
+    return false;
+}
+
+bool is_data_line(ReportKind kind, std::string_view line) {
+    if (line.empty() || line[0] == '-') {
+        return false;
+    }
+    switch (kind) {
+        case ReportKind::GROUPS:
+            return !contains(line, "COVERED") && line_classifier::is_group_data_line(line);
+        case ReportKind::HIERARCHY:
+            return !contains(line, "SCORE") && line_classifier::is_hierarchy_data_line(line);
+        case ReportKind::MODULES:
+            return !contains(line, "SCORE") && line_classifier::is_module_data_line(line);
+        case ReportKind::ASSERTS:
+            return !contains(line, "STATUS") &&
+                   (line_classifier::is_assert_status_line(line) ||
+                    line_classifier::is_assert_fraction_line(line) ||
+                    line_classifier::is_assert_general_line(line));
+    }
+    return false;
+}
+
+// SCORE ASSERT_SCORE COVERED/EXPECTED NAME, shared by hierarchy and module lines
+ParserResult decode_score_line(std::string_view line, double& total_score, CoverageMetrics& assert_coverage,
+                               std::string_view& name) {
+    tokenizer::FieldBuffer<4> fields;
+    tokenizer::split_with_tail(line, 3, fields);
+    if (fields.size() < 4) {
+        return ParserResult::ERROR_INVALID_FORMAT;
+    }
+
+    if (!utils::try_parse_double(fields[0], total_score) ||
+        !utils::try_parse_double(fields[1], assert_coverage.score)) {
+        return ParserResult::ERROR_PARSE_FAILED;
+    }
+    if (fields[2].find('/') != std::string_view::npos) {
+        if (!utils::try_parse_fraction(fields[2], assert_coverage.covered, assert_coverage.expected)) {
+            return ParserResult::ERROR_PARSE_FAILED;
+        }
+        assert_coverage.is_valid = true;
+    }
+    name = fields[3];
+    return ParserResult::SUCCESS;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Record Reader
+// ============================================================================
+
+RecordReader::RecordReader(const std::string& filename, ReportKind kind, const ParserConfig& config)
+    : file_(filename), kind_(kind), config_(config) {
+    if (!file_.is_open()) {
+        status_ = ParserResult::ERROR_FILE_NOT_FOUND;
+        finished_ = true;
+    } else if (!read_header()) {
+        status_ = ParserResult::ERROR_INVALID_FORMAT;
+        finished_ = true;
+    }
+}
+
+/**
+ * @brief Skip the report header, up to the column titles of the data section
+ * @return false if the report is not of the expected kind
+ */
+bool RecordReader::read_header() {
+    switch (kind_) {
+        case ReportKind::GROUPS: {
+            bool found_title = false;
+            while (std::getline(file_, line_)) {
+                if (contains(line_, "Group List")) {
+                    found_title = true;
+                    break;
+                }
+            }
+            if (!found_title) {
+                return false;
+            }
+            while (std::getline(file_, line_)) {
+                utils::try_parse_declared_total(line_, "Total groups in report", declared_total_);
+                if (contains(line_, "COVERED EXPECTED SCORE") && contains(line_, "NAME")) {
+                    break;
+                }
+            }
+            return true;
+        }
+        case ReportKind::HIERARCHY:
+            while (std::getline(file_, line_)) {
+                if (contains(line_, "SCORE") && contains(line_, "ASSERT")) {
+                    return true;
+                }
+            }
+            return false;
+        case ReportKind::MODULES:
+            while (std::getline(file_, line_)) {
+                utils::try_parse_declared_total(line_, "Total modules in report", declared_total_);
+                if (contains(line_, "SCORE") && contains(line_, "ASSERT") && contains(line_, "NAME")) {
+                    return true;
+                }
+            }
+            return false;
+        case ReportKind::ASSERTS:
+            while (std::getline(file_, line_)) {
+                utils::try_parse_declared_total(line_, "Total Assertions", declared_total_);
+                if ((contains(line_, "STATUS") && contains(line_, "ASSERTION")) ||
+                    (contains(line_, "ASSERT") && contains(line_, "NAME"))) {
+                    return true;
+                }
+            }
+            // Some assert reports have no column titles: read them from the start
+            file_.clear();
+            file_.seekg(0, std::ios::beg);
+            return true;
+    }
+    return false;
+}
+
+bool RecordReader::next() {
+    const std::uint32_t limit = record_limit(kind_, config_);
+    while (!finished_ && std::getline(file_, line_)) {
+        if (line_.empty() || contains(line_, "---") ||
+            is_header_line(kind_, line_) || !is_data_line(kind_, line_)) {
+            continue;
+        }
+
+        bool accepted = false;
+        if (decode_line(line_, accepted) == ParserResult::SUCCESS) {
+            ++records_read_;
+        } else if (++parse_errors_ > error_limit(kind_)) {
+            status_ = ParserResult::ERROR_PARSE_FAILED;
+            finished_ = true;
+            return false;
+        }
+
+        if (limit > 0 && records_read_ >= limit) {
+            finished_ = true;
+        }
+        if (accepted) {
+            return true;
+        }
+    }
+
+    // A corrupt or truncated compressed report ends the loop early
+    if (!finished_ && file_.bad()) {
+        status_ = ParserResult::ERROR_INVALID_FORMAT;
+    }
+    finished_ = true;
+    return false;
+}
+
+/**
+ * @brief Decode one data line into the current record
+ * @param accepted Set if the record also passes the configured filters
+ */
+ParserResult RecordReader::decode_line(std::string_view line, bool& accepted) {
+    switch (kind_) {
+        case ReportKind::GROUPS:
+            return decode_group(line, accepted);
+        case ReportKind::HIERARCHY:
+            return decode_instance(line, accepted);
+        case ReportKind::MODULES:
+            return decode_module(line, accepted);
+        case ReportKind::ASSERTS: {
+            ParserResult result = decode_assert(line);
+            accepted = (result == ParserResult::SUCCESS);
+            return result;
+        }
+    }
+    return ParserResult::ERROR_INVALID_PARAMETER;
+}
+
+/**
+ * @brief Decode a groups line
+ *
+ * COVERED EXPECTED SCORE INSTANCES WEIGHT GOAL AT_LEAST PER_INSTANCE AUTO_BIN_MAX PRINT_MISSING NAME,
+ * where INSTANCES is an instance score or "--" and NAME is the rest of the line.
+ */
+ParserResult RecordReader::decode_group(std::string_view line, bool& accepted) {
+    tokenizer::FieldBuffer<12> fields;
+    tokenizer::split_with_tail(line, 11, fields);
+    if (fields.size() < 12) {
+        return ParserResult::ERROR_INVALID_FORMAT;
+    }
+
+    GroupRecord& group = group_;
+    group = GroupRecord{};
+    if (!utils::try_parse_uint(fields[0], group.coverage.covered) ||
+        !utils::try_parse_uint(fields[1], group.coverage.expected) ||
+        !utils::try_parse_double(fields[2], group.coverage.score)) {
+        return ParserResult::ERROR_PARSE_FAILED;
+    }
+    group.coverage.is_valid = true;
+
+    if (!fields[3].empty() && fields[3] != "--") {
+        if (!utils::try_parse_double(fields[3], group.instance_coverage.score)) {
+            return ParserResult::ERROR_PARSE_FAILED;
+        }
+        group.instance_coverage.is_valid = true;
+    }
+
+    if (!utils::try_parse_uint(fields[4], group.instances) ||
+        !utils::try_parse_uint(fields[5], group.weight) ||
+        !utils::try_parse_uint(fields[6], group.goal) ||
+        !utils::try_parse_uint(fields[7], group.at_least) ||
+        !utils::try_parse_uint(fields[8], group.per_instance) ||
+        !utils::try_parse_uint(fields[9], group.auto_bin_max) ||
+        !utils::try_parse_uint(fields[10], group.print_missing)) {
+        return ParserResult::ERROR_PARSE_FAILED;
+    }
+    group.name = fields[11];
+    group.is_auto_generated = contains(group.name, "::") || contains(group.name, "_cg") || group.auto_bin_max > 0;
+
+    accepted = !(config_.ignore_empty_groups && group.coverage.expected == 0) &&
+               !(group.coverage.score < config_.min_coverage_threshold);
+    return ParserResult::SUCCESS;
+}
+
+/**
+ * @brief Decode a hierarchy line: SCORE ASSERT_SCORE COVERED/EXPECTED INSTANCE_PATH
+ */
+ParserResult RecordReader::decode_instance(std::string_view line, bool& accepted) {
+    HierarchyRecord& instance = instance_;
+    instance = HierarchyRecord{};
+    ParserResult result = decode_score_line(line, instance.total_score, instance.assert_coverage, instance.instance_path);
+    if (result != ParserResult::SUCCESS) {
+        return result;
+    }
+
+    // Same derivation as HierarchyParser::classify_instance()
+    std::string_view path = instance.instance_path;
+    instance.depth_level = static_cast<std::uint32_t>(std::count(path.begin(), path.end(), '.'));
+    std::size_t last_dot = path.find_last_of('.');
+    instance.module_name = last_dot != std::string_view::npos ? path.substr(last_dot + 1) : path;
+    instance.is_leaf_instance = contains(path, ".mem_") || contains(path, ".PDP") ||
+                                contains(path, "_0") || contains(path, "_1");
+
+    accepted = !(instance.total_score < config_.min_coverage_threshold);
+    return ParserResult::SUCCESS;
+}
+
+/**
+ * @brief Decode a module list line: SCORE ASSERT_SCORE COVERED/EXPECTED MODULE_NAME
+ */
+ParserResult RecordReader::decode_module(std::string_view line, bool& accepted) {
+    ModuleRecord& module = module_;
+    module = ModuleRecord{};
+    ParserResult result = decode_score_line(line, module.total_score, module.assert_coverage, module.module_name);
+    if (result != ParserResult::SUCCESS) {
+        return result;
+    }
+
+    // A module listed in the report has at least one instance
+    module.instance_count = 1;
+    module.covered_instances = module.assert_coverage.covered > 0 ? 1 : 0;
+
+    accepted = !(module.total_score < config_.min_coverage_threshold) &&
+               !(config_.ignore_empty_groups && module.assert_coverage.expected == 0);
+    return ParserResult::SUCCESS;
+}
+
+/**
+ * @brief Decode an assert line
+ *
+ * Three layouts, recognised by the first field:
+ * - STATUS HITS ASSERTION_NAME INSTANCE_PATH FILE:LINE
+ * - COVERED/EXPECTED ASSERTION_NAME INSTANCE_PATH
+ * - ASSERTION_NAME INSTANCE_PATH STATUS
+ */
+ParserResult RecordReader::decode_assert(std::string_view line) {
+    tokenizer::FieldBuffer<5> tokens;
+    tokenizer::split_fields(line, tokens);
+    if (tokens.size() < 3) {
+        return ParserResult::ERROR_INVALID_FORMAT;
+    }
+
+    AssertRecord& assert_cov = assert_;
+    assert_cov = AssertRecord{};
+    if (tokens[0] == "PASS" || tokens[0] == "FAIL" || tokens[0] == "COVERED" || tokens[0] == "UNCOVERED") {
+        assert_cov.is_covered = (tokens[0] == "PASS" || tokens[0] == "COVERED");
+        assert_cov.severity = tokens[0];
+        if (!utils::try_parse_uint(tokens[1], assert_cov.hit_count)) {
+            assert_cov.hit_count = assert_cov.is_covered ? 1 : 0;
+        }
+        assert_cov.assert_name = tokens[2];
+        if (tokens.size() > 3) {
+            assert_cov.instance_path = tokens[3];
+        }
+        if (tokens.size() > 4) {
+            std::string_view file_line = tokens[4];
+            std::size_t colon_pos = file_line.find_last_of(':');
+            if (colon_pos != std::string_view::npos) {
+                assert_cov.file_location = file_line.substr(0, colon_pos);
+                if (!utils::try_parse_uint(file_line.substr(colon_pos + 1), assert_cov.line_number)) {
+                    assert_cov.line_number = 0;
+                }
+            } else {
+                assert_cov.file_location = file_line;
+            }
+        }
+    } else if (tokens[0].find('/') != std::string_view::npos) {
+        std::uint32_t covered = 0;
+        std::uint32_t expected = 0;
+        if (!utils::try_parse_fraction(tokens[0], covered, expected)) {
+            return ParserResult::ERROR_PARSE_FAILED;
+        }
+        assert_cov.is_covered = (covered > 0);
+        assert_cov.hit_count = covered;
+        assert_cov.assert_name = tokens[1];
+        assert_cov.instance_path = tokens[2];
+    } else {
+        assert_cov.assert_name = tokens[0];
+        assert_cov.instance_path = tokens[1];
+        assert_cov.is_covered = (tokens[2] == "COVERED" || tokens[2] == "PASS" || tokens[2] == "1");
+        assert_cov.hit_count = assert_cov.is_covered ? 1 : 0;
+    }
+
+    if (assert_cov.severity.empty()) {
+        assert_cov.severity = assert_cov.is_covered ? "PASS" : "FAIL";
+    }
+    return ParserResult::SUCCESS;
+}
+
+// ============================================================================
+// Visitor Streaming
+// ============================================================================
+
+ParserResult stream_report(const std::string& filename, ReportKind kind, RecordVisitor& visitor,
+                           const ParserConfig& config) {
+    RecordReader reader(filename, kind, config);
+    while (reader.next()) {
+        bool more = true;
+        switch (kind) {
+            case ReportKind::GROUPS:    more = visitor.on_group(reader.group()); break;
+            case ReportKind::HIERARCHY: more = visitor.on_instance(reader.instance()); break;
+            case ReportKind::MODULES:   more = visitor.on_module(reader.module()); break;
+            case ReportKind::ASSERTS:   more = visitor.on_assert(reader.assert_record()); break;
+        }
+        if (!more) {
+            break;
+        }
+    }
+    return reader.status();
+}
+
+} // namespace coverage_parser
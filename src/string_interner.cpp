@@ -0,0 +1,149 @@
+/**
+ * @file string_interner.cpp
+ * @brief Implementation of the sharded string interner
+ *
+ * Stored text is carved out of a MemoryPool, so interning a string costs a
+ * bump allocation rather than a heap allocation, and clear() releases all
+ * text in O(chunks). Each shard's table is an open-addressing FlatHashMap
+ * whose keys keep the hash next to the view, so a string is hashed once per
+ * intern() call, never again on rehash, and a lookup touches no list node.
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#include "string_interner.h"
+#include "flat_hash_map.h"
+#include "memory_pool.h"
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <new>
+
+namespace coverage_parser {
+
+// ============================================================================
+// Shards
+// ============================================================================
+
+namespace {
+
+constexpr std::size_t SHARD_BITS = 6;
+constexpr std::size_t SHARD_COUNT = std::size_t(1) << SHARD_BITS;
+constexpr std::size_t TEXT_CHUNK_SIZE = 256 * 1024;
+
+struct Entry {
+    std::string_view text;
+    std::size_t hash;
+};
+
+struct EntryHash {
+    std::size_t operator()(const Entry& entry) const noexcept { return entry.hash; }
+};
+
+struct EntryEqual {
+    bool operator()(const Entry& lhs, const Entry& rhs) const noexcept { return lhs.text == rhs.text; }
+};
+
+// The key is the whole entry; the table stores nothing beside it
+struct NoValue {};
+
+struct alignas(64) Shard {  // Own cache line(s): shards are locked independently
+    mutable std::mutex mutex;
+    FlatHashMap<Entry, NoValue, EntryHash, EntryEqual> entries;
+};
+
+// High bits pick the shard; the table mixes the hash before probing
+std::size_t shard_index(std::size_t hash) {
+    return hash >> (sizeof(std::size_t) * 8 - SHARD_BITS);
+}
+
+} // anonymous namespace
+
+struct StringInterner::State {
+    Shard shards[SHARD_COUNT];
+    performance::MemoryPool text{TEXT_CHUNK_SIZE};
+    std::atomic<std::size_t> count{0};
+    std::atomic<std::size_t> bytes{0};
+};
+
+// ============================================================================
+// StringInterner Implementation
+// ============================================================================
+
+StringInterner::StringInterner() : state_(std::make_unique<State>()) {
+}
+
+StringInterner::~StringInterner() = default;
+
+std::string_view StringInterner::intern(std::string_view text) {
+    if (text.empty()) {
+        return std::string_view("", 0);
+    }
+
+    const Entry probe{text, std::hash<std::string_view>()(text)};
+    Shard& shard = state_->shards[shard_index(probe.hash)];
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.entries.find(probe);
+    if (it != shard.entries.end()) {
+        return it->first.text;
+    }
+
+    char* stored = static_cast<char*>(state_->text.allocate(text.size() + 1, 1));
+    if (!stored) {
+        throw std::bad_alloc();
+    }
+    std::memcpy(stored, text.data(), text.size());
+    stored[text.size()] = '\0';
+
+    std::string_view view(stored, text.size());
+    shard.entries.try_emplace(Entry{view, probe.hash});
+    state_->count.fetch_add(1, std::memory_order_relaxed);
+    state_->bytes.fetch_add(text.size() + 1, std::memory_order_relaxed);
+    return view;
+}
+
+std::string_view StringInterner::find(std::string_view text) const {
+    if (text.empty()) {
+        return std::string_view("", 0);
+    }
+
+    const Entry probe{text, std::hash<std::string_view>()(text)};
+    const Shard& shard = state_->shards[shard_index(probe.hash)];
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.entries.find(probe);
+    return it != shard.entries.end() ? it->first.text : std::string_view();
+}
+
+void StringInterner::clear() {
+    for (Shard& shard : state_->shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.entries.clear();
+    }
+    state_->text.reset();
+    state_->count.store(0, std::memory_order_relaxed);
+    state_->bytes.store(0, std::memory_order_relaxed);
+}
+
+void StringInterner::reserve(std::size_t count) {
+    // Hashes spread strings evenly; the slack absorbs shard imbalance
+    const std::size_t per_shard = count / SHARD_COUNT + count / (SHARD_COUNT * 8) + 1;
+    for (Shard& shard : state_->shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.entries.reserve(per_shard);
+    }
+}
+
+std::size_t StringInterner::size() const {
+    return state_->count.load(std::memory_order_relaxed);
+}
+
+std::size_t StringInterner::bytes() const {
+    return state_->bytes.load(std::memory_order_relaxed);
+}
+
+} // namespace coverage_parser
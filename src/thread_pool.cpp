@@ -0,0 +1,215 @@
+/**
+ * @file thread_pool.cpp
+ * @brief Implementation of the work-stealing thread pool
+ *
+ * Worker state lives in a reference-counted State object that every worker
+ * thread also holds. If the last owner of a pool is one of its own workers
+ * (a parse submitted to the pool that released the shared pool after a
+ * resize), that worker is detached instead of joining itself and keeps the
+ * state alive until it exits.
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#include "thread_pool.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+namespace coverage_parser {
+namespace performance {
+
+// ============================================================================
+// Worker State
+// ============================================================================
+
+namespace {
+
+using Task = std::function<void()>;
+
+struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+};
+
+std::size_t resolve_thread_count(std::size_t num_threads) {
+    if (num_threads == 0) {
+        num_threads = std::thread::hardware_concurrency();
+    }
+    return num_threads > 0 ? num_threads : 1;
+}
+
+} // anonymous namespace
+
+struct ThreadPool::State {
+    std::vector<std::unique_ptr<WorkerQueue>> queues;  // One per worker
+    std::atomic<std::size_t> pending{0};
+    std::atomic<std::size_t> next_queue{0};
+
+    std::mutex sleep_mutex;
+    std::condition_variable wake;
+    bool stopping = false;  // Guarded by sleep_mutex
+
+    // Pop from queue `first` LIFO, otherwise steal FIFO from the others
+    bool try_pop(std::size_t first, bool own_queue, Task& task) {
+        const std::size_t count = queues.size();
+        for (std::size_t i = 0; i < count; ++i) {
+            WorkerQueue& queue = *queues[(first + i) % count];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty()) {
+                continue;
+            }
+            if (i == 0 && own_queue) {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            } else {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+            pending.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+};
+
+namespace {
+
+// Identifies the pool (and queue) owned by the current worker thread
+thread_local const void* current_pool_state = nullptr;
+thread_local std::size_t current_worker_index = 0;
+
+} // anonymous namespace
+
+// ============================================================================
+// ThreadPool Implementation
+// ============================================================================
+
+ThreadPool::ThreadPool(std::size_t num_threads) : state_(std::make_shared<State>()) {
+    const std::size_t count = resolve_thread_count(num_threads);
+    for (std::size_t i = 0; i < count; ++i) {
+        state_->queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    threads_.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        threads_.emplace_back([state = state_, i]() {
+            current_pool_state = state.get();
+            current_worker_index = i;
+
+            Task task;
+            for (;;) {
+                if (state->try_pop(i, true, task)) {
+                    task();
+                    task = nullptr;
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(state->sleep_mutex);
+                state->wake.wait(lock, [&state]() {
+                    return state->stopping || state->pending.load(std::memory_order_relaxed) > 0;
+                });
+                if (state->stopping && state->pending.load(std::memory_order_relaxed) == 0) {
+                    return;
+                }
+            }
+        });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(state_->sleep_mutex);
+        state_->stopping = true;
+    }
+    state_->wake.notify_all();
+
+    for (std::thread& thread : threads_) {
+        if (thread.get_id() == std::this_thread::get_id()) {
+            thread.detach();
+        } else {
+            thread.join();
+        }
+    }
+}
+
+void ThreadPool::enqueue(Task task) {
+    State& state = *state_;
+    const std::size_t index = current_pool_state == state_.get() ?
+        current_worker_index :
+        state.next_queue.fetch_add(1, std::memory_order_relaxed) % state.queues.size();
+
+    // Counted under the queue lock, so a thief cannot pop (and uncount) the
+    // task before it is counted and wrap the counter below zero
+    {
+        WorkerQueue& queue = *state.queues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+        state.pending.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Taking the lock orders the increment against a worker's predicate check
+    { std::lock_guard<std::mutex> lock(state.sleep_mutex); }
+    state.wake.notify_one();
+}
+
+bool ThreadPool::run_pending_task() {
+    const bool is_worker = current_pool_state == state_.get();
+    Task task;
+    if (!state_->try_pop(is_worker ? current_worker_index : 0, is_worker, task)) {
+        return false;
+    }
+    task();
+    return true;
+}
+
+// ============================================================================
+// Shared Pool
+// ============================================================================
+
+namespace {
+
+std::mutex shared_pool_mutex;
+std::shared_ptr<ThreadPool> shared_pool;
+std::size_t shared_pool_size = 0;  // 0 = hardware concurrency
+
+} // anonymous namespace
+
+std::shared_ptr<ThreadPool> ThreadPool::shared() {
+    std::lock_guard<std::mutex> lock(shared_pool_mutex);
+    if (!shared_pool) {
+        shared_pool = std::make_shared<ThreadPool>(shared_pool_size);
+    }
+    return shared_pool;
+}
+
+void ThreadPool::set_shared_size(std::size_t num_threads) {
+    std::shared_ptr<ThreadPool> retired;
+    {
+        std::lock_guard<std::mutex> lock(shared_pool_mutex);
+        shared_pool_size = num_threads;
+        if (shared_pool && shared_pool->size() != resolve_thread_count(num_threads)) {
+            retired = std::move(shared_pool);
+        }
+    }
+    // Joined here (outside the lock) unless a parse still holds it
+}
+
+std::size_t ThreadPool::shared_size() {
+    std::lock_guard<std::mutex> lock(shared_pool_mutex);
+    return shared_pool ? shared_pool->size() : resolve_thread_count(shared_pool_size);
+}
+
+void ThreadPool::reset_shared() {
+    std::shared_ptr<ThreadPool> retired;
+    {
+        std::lock_guard<std::mutex> lock(shared_pool_mutex);
+        retired = std::move(shared_pool);
+    }
+}
+
+} // namespace performance
+} // namespace coverage_parser
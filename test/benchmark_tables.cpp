@@ -0,0 +1,157 @@
+/**
+ * @file benchmark_tables.cpp
+ * @brief Benchmark of the database table layout: FlatHashMap vs std::unordered_map
+ *
+ * Both tables map string_view keys (views of one shared buffer, as interned
+ * names are) to owning record pointers, which is how CoverageDatabase stores
+ * its four tables. Three phases are timed for each entry count:
+ *   insert  - insert every key into an empty table
+ *   lookup  - find every key, in a shuffled order, plus as many misses
+ *   iterate - walk the whole table, touching every record
+ *
+ * Build with -DBUILD_BENCHMARKS=ON, then run:
+ *   benchmark_tables [entries...]     (default: 1000000 10000000)
+ *
+ * @author FunctionalCoverageParsers Library
+ * @version 1.0
+ * @date 2025
+ */
+
+#include "../include/flat_hash_map.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+using namespace coverage_parser;
+
+namespace {
+
+// Stand-in for a coverage record: the tables only own a pointer to it
+struct Record {
+    std::uint32_t hit_count = 0;
+    double score = 0.0;
+};
+
+struct KeySet {
+    std::string buffer;
+    std::vector<std::string_view> present;  // Inserted keys
+    std::vector<std::string_view> absent;   // Never inserted
+};
+
+// Hierarchical assertion-like names: tb.top.u<i/64>.chk_<i>
+KeySet make_keys(std::size_t count) {
+    KeySet keys;
+    std::vector<std::pair<std::size_t, std::size_t>> ranges;
+    ranges.reserve(2 * count);
+    for (std::size_t i = 0; i < 2 * count; ++i) {
+        const std::size_t start = keys.buffer.size();
+        keys.buffer += "tb.top.u" + std::to_string(i / 64) + ".chk_" + std::to_string(i);
+        ranges.emplace_back(start, keys.buffer.size() - start);
+    }
+
+    keys.present.reserve(count);
+    keys.absent.reserve(count);
+    for (std::size_t i = 0; i < ranges.size(); ++i) {
+        std::string_view key(keys.buffer.data() + ranges[i].first, ranges[i].second);
+        (i % 2 == 0 ? keys.present : keys.absent).push_back(key);
+    }
+    return keys;
+}
+
+double elapsed_ms(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+struct Timings {
+    double insert_ms = 0.0;
+    double lookup_ms = 0.0;
+    double iterate_ms = 0.0;
+    std::uint64_t checksum = 0;  // Keeps the optimizer from dropping work
+};
+
+template <typename Table>
+Timings run(const KeySet& keys, const std::vector<std::string_view>& lookup_order) {
+    Timings timings;
+    Table table;
+
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < keys.present.size(); ++i) {
+        auto record = std::make_unique<Record>();
+        record->hit_count = static_cast<std::uint32_t>(i);
+        table[keys.present[i]] = std::move(record);
+    }
+    timings.insert_ms = elapsed_ms(start);
+
+    start = std::chrono::steady_clock::now();
+    for (std::string_view key : lookup_order) {
+        auto it = table.find(key);
+        if (it != table.end()) {
+            timings.checksum += it->second->hit_count;
+        }
+    }
+    for (std::string_view key : keys.absent) {
+        timings.checksum += table.find(key) == table.end() ? 0 : 1;
+    }
+    timings.lookup_ms = elapsed_ms(start);
+
+    start = std::chrono::steady_clock::now();
+    for (const auto& [key, record] : table) {
+        timings.checksum += key.size() + record->hit_count;
+    }
+    timings.iterate_ms = elapsed_ms(start);
+
+    return timings;
+}
+
+void print_row(const char* name, const Timings& timings, std::size_t count) {
+    const double per_op = 1e6 / static_cast<double>(count);  // ms per count ops -> ns per op
+    std::cout << "  " << std::left << std::setw(20) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << timings.insert_ms << " ms (" << std::setw(6) << timings.insert_ms * per_op << " ns/op)"
+              << std::setw(10) << timings.lookup_ms << " ms (" << std::setw(6) << timings.lookup_ms * per_op / 2 << " ns/op)"
+              << std::setw(10) << timings.iterate_ms << " ms (" << std::setw(6) << timings.iterate_ms * per_op << " ns/op)"
+              << std::endl;
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> counts;
+    for (int i = 1; i < argc; ++i) {
+        counts.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (counts.empty()) {
+        counts = {1000000, 10000000};
+    }
+
+    for (std::size_t count : counts) {
+        KeySet keys = make_keys(count);
+        std::vector<std::string_view> lookup_order = keys.present;
+        std::shuffle(lookup_order.begin(), lookup_order.end(), std::mt19937_64(42));
+
+        std::cout << "Entries: " << count << std::endl;
+        std::cout << "  " << std::left << std::setw(20) << "table" << std::right
+                  << std::setw(28) << "insert" << std::setw(28) << "lookup (hit+miss)"
+                  << std::setw(28) << "iterate" << std::endl;
+
+        Timings node = run<std::unordered_map<std::string_view, std::unique_ptr<Record>>>(keys, lookup_order);
+        print_row("std::unordered_map", node, count);
+        Timings flat = run<FlatHashMap<std::string_view, std::unique_ptr<Record>>>(keys, lookup_order);
+        print_row("FlatHashMap", flat, count);
+
+        if (node.checksum != flat.checksum) {
+            std::cerr << "Checksum mismatch: tables disagree" << std::endl;
+            return 1;
+        }
+        std::cout << std::endl;
+    }
+    return 0;
+}
@@ -11,12 +11,28 @@
  */
 
 #include "../include/functional_coverage_parser.h"
+#include "../include/high_performance_parser.h"
+#include "../include/thread_pool.h"
+#include "../include/coverage_snapshot.h"
+#include "../include/compressed_input.h"
+#include "../include/line_classifier.h"
+#include "../include/parse_cache.h"
+#include "../include/record_stream.h"
+#include "../include/line_tokenizer.h"
 #include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <cassert>
 #include <vector>
 #include <chrono>
+#include <thread>
+#include <filesystem>
+#include <random>
+#include <utility>
 
 using namespace coverage_parser;
+using namespace coverage_parser::performance;
 
 // Test result tracking
 static int util_tests_total = 0;
@@ -110,7 +126,32 @@ void test_number_utilities() {
     UTIL_TEST_ASSERT(std::abs(utils::parse_double("123.45", 0.0) - 123.45) < 0.01, "Parse double valid", "123.45", std::to_string(utils::parse_double("123.45", 0.0)));
     UTIL_TEST_ASSERT(std::abs(utils::parse_double("-67.89", 0.0) - (-67.89)) < 0.01, "Parse double negative", "-67.89", std::to_string(utils::parse_double("-67.89", 0.0)));
     UTIL_TEST_ASSERT(std::abs(utils::parse_double("invalid", 99.9) - 99.9) < 0.01, "Parse double invalid", "99.9", std::to_string(utils::parse_double("invalid", 99.9)));
+
+    // Test exception-free field parsers
+    uint32_t covered = 0, expected = 0, value = 7;
+    double score = 0.0;
+    UTIL_TEST_ASSERT(utils::try_parse_fraction("60148/272087", covered, expected) && covered == 60148 && expected == 272087, "Try parse fraction", "60148/272087", std::to_string(covered) + "/" + std::to_string(expected));
+    UTIL_TEST_ASSERT(!utils::try_parse_fraction("12/", covered, expected), "Try parse fraction missing denominator", "false", "true");
+    
+    std::uint32_t total = 0;
+    UTIL_TEST_ASSERT(utils::try_parse_declared_total("Total groups in report: 16295", "Total groups in report", total) && total == 16295, "Try parse declared total", "16295", std::to_string(total));
+    UTIL_TEST_ASSERT(!utils::try_parse_declared_total("Total groups in report:", "Total groups in report", total), "Try parse declared total missing count", "false", "true");
+    UTIL_TEST_ASSERT(utils::expected_record_count(4000000000u, 8000, 100) == 1001 && utils::expected_record_count(500, 8000, 100) == 500 && utils::expected_record_count(0, 8000, 100, 50) == 50, "Expected record count bounded by file size", "1001", std::to_string(utils::expected_record_count(4000000000u, 8000, 100)));
     
+    // A corrupt header total must not make the parsers pre-size gigabytes
+    const std::string report = "test_util_inflated_total.txt";
+    std::ofstream(report) << "Testbench Group List\n\nTotal groups in report: 4000000000\n"
+                          << "COVERED EXPECTED SCORE INSTANCES WEIGHT GOAL AT_LEAST PER_INSTANCE AUTO_BIN_MAX PRINT_MISSING COMMENT NAME\n------\n"
+                          << "  3  4  75.0  --  1  1  100  1  1  64  64  tb.cpu::cg_alu\n";
+    CoverageDatabase standard_db, fast_db;
+    ParserResult standard_result = GroupsParser().parse(report, standard_db);
+    ParserResult fast_result = HighPerformanceGroupsParser().parse(report, fast_db);
+    UTIL_TEST_ASSERT(standard_result == ParserResult::SUCCESS && fast_result == ParserResult::SUCCESS && standard_db.get_num_groups() == 1 && fast_db.get_num_groups() == 1, "Inflated declared total parses", "SUCCESS", parser_result_to_string(standard_result) + "/" + parser_result_to_string(fast_result));
+    std::remove(report.c_str());
+    UTIL_TEST_ASSERT(utils::try_parse_double("41.01", score) && std::abs(score - 41.01) < 0.001, "Try parse double", "41.01", std::to_string(score));
+    UTIL_TEST_ASSERT(!utils::try_parse_uint("12abc", value) && value == 7, "Try parse uint rejects trailing text", "7", std::to_string(value));
+    UTIL_TEST_ASSERT(!utils::try_parse_uint("4294967296", value), "Try parse uint overflow", "false", "true");
+
     // Test is_number function
     UTIL_TEST_ASSERT(utils::is_number("123"), "Is number integer", "true", "false");
     UTIL_TEST_ASSERT(utils::is_number("123.45"), "Is number float", "true", "false");
@@ -230,6 +271,1185 @@ void test_datetime_utilities() {
     UTIL_TEST_ASSERT(invalid_epoch == 0, "Parse datetime invalid", "0", std::to_string(invalid_epoch));
 }
 
+/**
+ * @brief Test the high-performance hierarchy parser against HierarchyParser
+ */
+void test_fast_hierarchy_parser() {
+    std::cout << "\n=== Fast Hierarchy Parser Tests ===" << std::endl;
+    
+    // Over 1 MiB, so a multi-threaded pool splits it into several chunks;
+    // the malformed lines (overflowing fractions) are spread over all of them
+    const std::string report = "test_util_fast_hierarchy.txt";
+    const std::uint32_t lines = 30000;
+    auto write_report = [&report, lines](std::uint32_t malformed) {
+        std::ofstream file(report);
+        file << "Design Hierarchy\n\n----------------\nSCORE   ASSERT        \n";
+        for (std::uint32_t i = 0; i < lines; ++i) {
+            if (i % (lines / malformed) == lines / malformed / 2) {
+                file << "  1.00    1.00 99999999999/4   tb.bad" << i << "\n";
+            } else {
+                file << "  " << i % 100 << ".50    1.25 " << i % 7 << "/66   tb.cpu" << i % 50 << ".u" << i << "\n";
+            }
+        }
+    };
+    
+    write_report(3);
+    CoverageDatabase expected;
+    ParserResult expected_result = HierarchyParser().parse(report, expected);
+    for (std::size_t threads : {1, 4}) {
+        ThreadPool::set_shared_size(threads);
+        CoverageDatabase db;
+        ParserResult result = HighPerformanceHierarchyParser().parse(report, db);
+        std::size_t mismatches = 0;
+        for (const auto& [path, instance] : expected.hierarchy_table) {
+            const HierarchyInstance* parsed = db.find_hierarchy_instance(path);
+            mismatches += !parsed || parsed->module_name != instance->module_name ||
+                          parsed->total_score != instance->total_score ||
+                          parsed->assert_coverage.covered != instance->assert_coverage.covered ||
+                          parsed->assert_coverage.expected != instance->assert_coverage.expected ||
+                          parsed->depth_level != instance->depth_level ||
+                          parsed->is_leaf_instance != instance->is_leaf_instance;
+        }
+        UTIL_TEST_ASSERT(expected_result == ParserResult::SUCCESS && result == ParserResult::SUCCESS && db.get_num_hierarchy_instances() == lines - 3 && expected.get_num_hierarchy_instances() == lines - 3 && mismatches == 0, "Fast hierarchy matches standard, " + std::to_string(threads) + " threads", "0 mismatches", std::to_string(mismatches) + " mismatches, " + std::to_string(db.get_num_hierarchy_instances()) + " instances");
+    }
+    
+    // More than 20 malformed lines fail the file, even when no chunk holds 20
+    write_report(24);
+    CoverageDatabase standard_db, fast_db;
+    ParserResult standard_result = HierarchyParser().parse(report, standard_db);
+    ParserResult fast_result = HighPerformanceHierarchyParser().parse(report, fast_db);
+    UTIL_TEST_ASSERT(standard_result == ParserResult::ERROR_PARSE_FAILED && fast_result == ParserResult::ERROR_PARSE_FAILED, "Fast hierarchy error budget per file", "ERROR_PARSE_FAILED", parser_result_to_string(fast_result));
+    
+    ThreadPool::set_shared_size(0);
+    std::remove(report.c_str());
+}
+
+/**
+ * @brief Test the high-performance assert parser against AssertParser
+ */
+void test_fast_assert_parser() {
+    std::cout << "\n=== Fast Assert Parser Tests ===" << std::endl;
+    
+    // Over 1 MiB, so a multi-threaded pool splits it into several chunks;
+    // the malformed lines (overflowing fractions) are spread over all of them
+    const std::string report = "test_util_fast_asserts.txt";
+    const std::uint32_t lines = 50000;
+    auto write_report = [&report, lines](std::uint32_t malformed) {
+        std::ofstream file(report);
+        file << "Assertion Coverage Report\nASSERT NAME\n---\n";
+        for (std::uint32_t i = 0; i < lines; ++i) {
+            if (i % (lines / malformed) == lines / malformed / 2) {
+                file << "99999999999/4 chk_bad_" << i << " tb.bad\n";
+            } else {
+                file << i % 5 << "/4 chk_" << i << " tb.cpu" << i % 50 << ".u" << i << "\n";
+            }
+        }
+    };
+    
+    write_report(3);
+    CoverageDatabase expected;
+    ParserResult expected_result = AssertParser().parse(report, expected);
+    for (std::size_t threads : {1, 4}) {
+        ThreadPool::set_shared_size(threads);
+        CoverageDatabase db;
+        ParserResult result = HighPerformanceAssertParser().parse(report, db);
+        std::size_t mismatches = 0;
+        for (const auto& [name, assert_cov] : expected.asserts_table) {
+            const AssertCoverage* parsed = db.find_assert_coverage(name);
+            mismatches += !parsed || parsed->instance_path != assert_cov->instance_path ||
+                          parsed->is_covered != assert_cov->is_covered ||
+                          parsed->hit_count != assert_cov->hit_count ||
+                          parsed->severity != assert_cov->severity;
+        }
+        UTIL_TEST_ASSERT(expected_result == ParserResult::SUCCESS && result == ParserResult::SUCCESS && db.get_num_asserts() == lines - 3 && expected.get_num_asserts() == lines - 3 && mismatches == 0, "Fast asserts match standard, " + std::to_string(threads) + " threads", "0 mismatches", std::to_string(mismatches) + " mismatches, " + std::to_string(db.get_num_asserts()) + " asserts");
+    }
+    
+    // More than 50 malformed lines fail the file, even when no chunk holds 50
+    write_report(60);
+    CoverageDatabase standard_db, fast_db;
+    ParserResult standard_result = AssertParser().parse(report, standard_db);
+    ParserResult fast_result = HighPerformanceAssertParser().parse(report, fast_db);
+    UTIL_TEST_ASSERT(standard_result == ParserResult::ERROR_PARSE_FAILED && fast_result == ParserResult::ERROR_PARSE_FAILED, "Fast assert error budget per file", "ERROR_PARSE_FAILED", parser_result_to_string(fast_result));
+    
+    // Summary lines starting like a status keyword are skipped, not malformed
+    {
+        std::ofstream file(report);
+        file << "Assertion Coverage Report\nSTATUS  HITS  ASSERTION  INSTANCE  FILE:LINE\n";
+        for (std::uint32_t i = 0; i < 100; ++i) {
+            file << (i % 2 ? "PASS" : "FAIL") << "    " << (i % 2 ? i : 0) << "    chk_" << i << "    tb.cpu    cpu.sv:" << i + 1 << "\n"
+                 << "Coverage: " << i << "%\nFailed: " << i << "\nUncovered assertions: " << i << "\nPASSED " << i << " of 100\n";
+        }
+    }
+    CoverageDatabase status_db;
+    fast_result = HighPerformanceAssertParser().parse(report, status_db);
+    UTIL_TEST_ASSERT(fast_result == ParserResult::SUCCESS && status_db.get_num_asserts() == 100 && status_db.find_assert_coverage("chk_99") && status_db.find_assert_coverage("chk_99")->hit_count == 99, "Fast assert skips summary lines", "SUCCESS 100", parser_result_to_string(fast_result) + " " + std::to_string(status_db.get_num_asserts()));
+    
+    ThreadPool::set_shared_size(0);
+    std::remove(report.c_str());
+}
+
+/**
+ * @brief Test the high-performance module list parser against ModuleListParser
+ */
+void test_fast_module_list_parser() {
+    std::cout << "\n=== Fast Module List Parser Tests ===" << std::endl;
+    
+    // Over 1 MiB, so a multi-threaded pool splits it into several chunks;
+    // the malformed lines (overflowing fractions) are spread over all of them
+    const std::string report = "test_util_fast_modlist.txt";
+    const std::uint32_t lines = 30000;
+    auto write_report = [&report, lines](std::uint32_t malformed) {
+        std::ofstream file(report);
+        file << "Design Module List\n\nTotal modules in report: " << lines << "\n----------\n"
+             << "SCORE   ASSERT          NAME   \n";
+        for (std::uint32_t i = 0; i < lines; ++i) {
+            if (i % (lines / malformed) == lines / malformed / 2) {
+                file << "  1.00    1.00 99999999999/4      mod_bad_" << i << "\n";
+            } else {
+                file << "  " << i % 100 << ".50    " << i % 50 << ".25 " << i % 9 << "/" << i % 9 + 3 << "      mod_" << i << "_x\n";
+            }
+        }
+    };
+    
+    write_report(3);
+    CoverageDatabase expected;
+    ParserResult expected_result = ModuleListParser().parse(report, expected);
+    for (std::size_t threads : {1, 4}) {
+        ThreadPool::set_shared_size(threads);
+        CoverageDatabase db;
+        ParserResult result = HighPerformanceModuleListParser().parse(report, db);
+        std::size_t mismatches = 0;
+        for (const auto& [name, module] : expected.modules_table) {
+            const ModuleDefinition* parsed = db.find_module_definition(name);
+            mismatches += !parsed || parsed->total_score != module->total_score ||
+                          parsed->assert_coverage.score != module->assert_coverage.score ||
+                          parsed->assert_coverage.covered != module->assert_coverage.covered ||
+                          parsed->assert_coverage.expected != module->assert_coverage.expected;
+        }
+        UTIL_TEST_ASSERT(expected_result == ParserResult::SUCCESS && result == ParserResult::SUCCESS && db.get_num_modules() == lines - 3 && expected.get_num_modules() == lines - 3 && mismatches == 0, "Fast modules match standard, " + std::to_string(threads) + " threads", "0 mismatches", std::to_string(mismatches) + " mismatches, " + std::to_string(db.get_num_modules()) + " modules");
+    }
+    
+    // More than 10 malformed lines fail the file, even when no chunk holds 10
+    write_report(14);
+    CoverageDatabase standard_db, fast_db;
+    ParserResult standard_result = ModuleListParser().parse(report, standard_db);
+    ParserResult fast_result = HighPerformanceModuleListParser().parse(report, fast_db);
+    UTIL_TEST_ASSERT(standard_result == ParserResult::ERROR_PARSE_FAILED && fast_result == ParserResult::ERROR_PARSE_FAILED, "Fast module list error budget per file", "ERROR_PARSE_FAILED", parser_result_to_string(fast_result));
+    
+    ThreadPool::set_shared_size(0);
+    std::remove(report.c_str());
+}
+
+/**
+ * @brief Test regex-free data line classifiers
+ */
+void test_line_classifiers() {
+    std::cout << "\n=== Line Classifier Tests ===" << std::endl;
+    
+    // Groups: \s*\d+\s+\d+\s+[\d\-\.]+.*
+    UTIL_TEST_ASSERT(line_classifier::is_group_data_line("  45  89  2  1  120  tb.cpu.alu::ops"), "Group line valid", "true", "false");
+    UTIL_TEST_ASSERT(line_classifier::is_group_data_line("0 0 -- tb.cg"), "Group line dashes", "true", "false");
+    UTIL_TEST_ASSERT(!line_classifier::is_group_data_line("45.2 89 2 tb.cg"), "Group line decimal first field", "false", "true");
+    UTIL_TEST_ASSERT(!line_classifier::is_group_data_line("1 2 3 tb.cg\r"), "Group line trailing CR", "false", "true");
+    
+    // Hierarchy / modlist: \s*\d+\.\d+\s+\d+\.\d+\s+\d+/\d+\s+.+
+    UTIL_TEST_ASSERT(line_classifier::is_hierarchy_data_line("  0.00    0.00 0/66   tb.mem_0_0.PDP"), "Hierarchy line valid", "true", "false");
+    UTIL_TEST_ASSERT(line_classifier::is_hierarchy_data_line("  0.00    0.00 0/66   "), "Hierarchy line whitespace tail", "true", "false");
+    UTIL_TEST_ASSERT(!line_classifier::is_hierarchy_data_line("  0.00    0.00 0/66"), "Hierarchy line no name", "false", "true");
+    UTIL_TEST_ASSERT(line_classifier::is_module_data_line(" 12.50 12.50 1/8 my_module"), "Module line valid", "true", "false");
+    
+    // Dashboard: ...\d+/\d+.*\w+
+    UTIL_TEST_ASSERT(line_classifier::is_dashboard_instance_line("  0.00    0.00 0/66   dcec.PDP"), "Dashboard line valid", "true", "false");
+    UTIL_TEST_ASSERT(!line_classifier::is_dashboard_instance_line("  0.00    0.00 0/6"), "Dashboard line single digit", "false", "true");
+    
+    // Asserts
+    UTIL_TEST_ASSERT(line_classifier::is_assert_status_line("PASS 12 chk tb.u0 f.sv:4"), "Assert status line", "true", "false");
+    UTIL_TEST_ASSERT(!line_classifier::is_assert_status_line("PASSED 12 chk"), "Assert status keyword prefix", "false", "true");
+    UTIL_TEST_ASSERT(line_classifier::is_assert_fraction_line(" 3/4 chk tb.u0"), "Assert fraction line", "true", "false");
+    UTIL_TEST_ASSERT(line_classifier::is_assert_general_line("chk tb.u0 COVERED"), "Assert general line", "true", "false");
+    UTIL_TEST_ASSERT(!line_classifier::is_assert_general_line(" ab"), "Assert general too short", "false", "true");
+}
+
+/**
+ * @brief Test zero-copy line tokenizer
+ */
+void test_line_tokenizer() {
+    std::cout << "\n=== Line Tokenizer Tests ===" << std::endl;
+    
+    tokenizer::FieldBuffer<4> fields;
+    tokenizer::split_with_tail("  0.00  0.00 0/66   tb.u core.mem_0 \t", 3, fields);
+    UTIL_TEST_ASSERT(fields.size() == 4, "Tail split count", "4", std::to_string(fields.size()));
+    UTIL_TEST_ASSERT(fields[2] == "0/66", "Tail split field 2", "0/66", std::string(fields[2]));
+    UTIL_TEST_ASSERT(fields[3] == "tb.u core.mem_0", "Tail split trims tail", "tb.u core.mem_0", std::string(fields[3]));
+    
+    tokenizer::split_with_tail("0.00 0.00 0/66   ", 3, fields);
+    UTIL_TEST_ASSERT(fields.size() == 3, "Tail split blank tail", "3", std::to_string(fields.size()));
+    
+    tokenizer::FieldBuffer<2> small;
+    bool fit = tokenizer::split_fields("a b c", small);
+    UTIL_TEST_ASSERT(!fit && small.size() == 2 && small[1] == "b", "Split fields capacity", "2 fields, truncated", std::to_string(small.size()));
+}
+
+/**
+ * @brief Test that every SIMD tier the CPU supports agrees with the scalar kernels
+ */
+void test_simd_kernels() {
+    std::cout << "\n=== SIMD Kernel Tests ===" << std::endl;
+    
+    // Random bytes over whitespace, newlines, text and high-bit bytes, with
+    // leading whitespace runs that cross vector widths
+    std::mt19937 random(20250915);
+    const char alphabet[] = {' ', ' ', '\t', '\n', '\r', 'a', 'Z', '0', '9', '/', '.', '\x80', '\xff'};
+    std::vector<std::string> buffers;
+    for (std::size_t size : {0, 1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 127, 200, 1000, 40000}) {
+        for (int variant = 0; variant < 4; ++variant) {
+            std::string buffer(size, ' ');
+            std::size_t leading = size == 0 ? 0 : random() % (size + 1);
+            for (std::size_t i = leading; i < size; ++i) {
+                buffer[i] = alphabet[random() % sizeof(alphabet)];
+            }
+            buffers.push_back(std::move(buffer));
+        }
+    }
+    
+    // Kernel results for every buffer at every offset, as one comparable string
+    std::vector<char> storage(40000 + 128);
+    auto run_kernels = [&]() {
+        std::string results;
+        for (const std::string& buffer : buffers) {
+            for (std::size_t offset = 0; offset < 64; offset += (buffer.size() > 1000 ? 13 : 1)) {
+                char* data = storage.data() + offset;
+                std::memcpy(data, buffer.data(), buffer.size());
+                const char* end = data + buffer.size();
+                
+                for (char target : {'\n', 'a', '\xff', '#'}) {
+                    const char* found = simd::find_char_simd(data, buffer.size(), target);
+                    results += std::to_string(found ? found - data : -1) + ",";
+                }
+                for (std::size_t newline : simd::find_newlines_simd(data, buffer.size())) {
+                    results += std::to_string(newline) + ",";
+                }
+                results += std::to_string(simd::skip_whitespace_simd(data, end) - data) + ";";
+                simd::LineScanner lines(data, buffer.size());
+                for (std::string_view line; lines.next(line);) {
+                    results += std::to_string(line.data() - data) + "+" + std::to_string(line.size()) + ",";
+                }
+                results += "|";
+            }
+        }
+        return results;
+    };
+    
+    const simd::SimdLevel active = simd::active_simd_level();
+    simd::set_active_simd_level(simd::SimdLevel::SCALAR);
+    const std::string scalar = run_kernels();
+    
+    // Scalar itself against the standard library
+    std::size_t scalar_mismatches = 0;
+    for (const std::string& buffer : buffers) {
+        const char* found = simd::find_char_simd(buffer.data(), buffer.size(), '\n');
+        const void* expected = buffer.empty() ? nullptr : std::memchr(buffer.data(), '\n', buffer.size());
+        scalar_mismatches += found != expected;
+    }
+    UTIL_TEST_ASSERT(scalar_mismatches == 0, "Scalar find_char matches memchr", "0", std::to_string(scalar_mismatches));
+    
+    for (simd::SimdLevel level : {simd::SimdLevel::SSE2, simd::SimdLevel::AVX2, simd::SimdLevel::AVX512BW}) {
+        if (level > simd::detected_simd_level()) {
+            std::cout << "(" << simd::simd_level_name(level) << " not supported; skipping)" << std::endl;
+            continue;
+        }
+        simd::set_active_simd_level(level);
+        const bool agrees = simd::active_simd_level() == level && run_kernels() == scalar;
+        UTIL_TEST_ASSERT(agrees, std::string(simd::simd_level_name(level)) + " kernels match scalar", "identical results", "mismatch");
+    }
+    
+    // Rebinding while another thread runs the kernels never mixes tiers
+    std::atomic<bool> rebinding{true};
+    std::size_t racing_mismatches = 0;
+    std::thread reader([&]() {
+        while (rebinding.load()) {
+            racing_mismatches += run_kernels() != scalar;
+        }
+    });
+    for (int i = 0; i < 2000; ++i) {
+        simd::set_active_simd_level(static_cast<simd::SimdLevel>(i % 4));
+    }
+    rebinding.store(false);
+    reader.join();
+    UTIL_TEST_ASSERT(racing_mismatches == 0, "Kernels rebound during calls", "0", std::to_string(racing_mismatches));
+    simd::set_active_simd_level(active);
+}
+
+/**
+ * @brief Test the work-stealing thread pool: nested tasks and shared pool lifetime
+ */
+void test_thread_pool() {
+    std::cout << "\n=== Thread Pool Tests ===" << std::endl;
+    
+    // More outer tasks than workers, each waiting on tasks it submits itself:
+    // waiting threads must run queued tasks or the pool deadlocks
+    ThreadPool pool(2);
+    TaskGroup<int> outer(pool);
+    for (int i = 0; i < 8; ++i) {
+        outer.submit([&pool, i]() {
+            TaskGroup<int> inner(pool);
+            for (int j = 0; j < 4; ++j) {
+                inner.submit([i, j]() { return i * 4 + j; });
+            }
+            int sum = 0;
+            for (std::size_t j = 0; j < inner.size(); ++j) {
+                sum += inner.get(j);
+            }
+            return sum;
+        });
+    }
+    int total = 0;
+    for (std::size_t i = 0; i < outer.size(); ++i) {
+        total += outer.get(i);
+    }
+    UTIL_TEST_ASSERT(total == 496, "Nested task submission", "496", std::to_string(total));
+    
+    // Resizing hands out a new pool; work still queued on the old one completes
+    ThreadPool::set_shared_size(2);
+    std::shared_ptr<ThreadPool> old_pool = ThreadPool::shared();
+    std::size_t finished = 0;
+    {
+        TaskGroup<int> tasks(*old_pool);
+        for (int i = 0; i < 16; ++i) {
+            tasks.submit([i]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                return i;
+            });
+        }
+        ThreadPool::set_shared_size(3);
+        UTIL_TEST_ASSERT(ThreadPool::shared() != old_pool && ThreadPool::shared()->size() == 3 && ThreadPool::shared_size() == 3, "Shared pool resized", "3", std::to_string(ThreadPool::shared_size()));
+        for (std::size_t i = 0; i < tasks.size(); ++i) {
+            finished += tasks.get(i) == static_cast<int>(i);
+        }
+    }
+    UTIL_TEST_ASSERT(finished == 16 && old_pool->size() == 2, "Old pool drains after resize", "16", std::to_string(finished));
+    old_pool.reset();
+    
+    // reset_shared() keeps the configured size for the next pool
+    std::shared_ptr<ThreadPool> before = ThreadPool::shared();
+    ThreadPool::reset_shared();
+    std::shared_ptr<ThreadPool> after = ThreadPool::shared();
+    UTIL_TEST_ASSERT(after != before && after->size() == 3 && after->submit([]() { return 7; }).get() == 7, "Shared pool reset", "3", std::to_string(after->size()));
+    before.reset();
+    after.reset();
+    ThreadPool::set_shared_size(0);
+}
+
+/**
+ * @brief Test the thread-local bump arena under concurrent allocation and reset
+ */
+void test_memory_pool() {
+    std::cout << "\n=== Memory Pool Tests ===" << std::endl;
+    
+    // Each thread fills its blocks with its own byte; any block handed out
+    // twice shows up as an overlap or as another thread's byte
+    MemoryPool pool(16 * 1024);
+    const std::size_t threads = 4, blocks_per_thread = 2000, block_size = 48;
+    auto allocate_all = [&]() {
+        std::vector<std::vector<unsigned char*>> blocks(threads);
+        std::vector<std::thread> workers;
+        for (std::size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t]() {
+                for (std::size_t i = 0; i < blocks_per_thread; ++i) {
+                    auto* block = static_cast<unsigned char*>(pool.allocate(i % 7 == 0 ? 5000 : block_size));
+                    std::memset(block, static_cast<int>(t + 1), block_size);
+                    blocks[t].push_back(block);
+                }
+            });
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        
+        std::vector<unsigned char*> all;
+        std::size_t corrupted = 0;
+        for (std::size_t t = 0; t < threads; ++t) {
+            for (unsigned char* block : blocks[t]) {
+                corrupted += block[0] != t + 1 || block[block_size - 1] != t + 1;
+                all.push_back(block);
+            }
+        }
+        std::sort(all.begin(), all.end());
+        std::size_t overlaps = 0;
+        for (std::size_t i = 1; i < all.size(); ++i) {
+            overlaps += all[i] < all[i - 1] + block_size;
+        }
+        return corrupted + overlaps;
+    };
+    
+    std::size_t first_errors = allocate_all();
+    UTIL_TEST_ASSERT(first_errors == 0 && pool.total_allocated() > 0, "Concurrent arena allocation", "0 overlaps", std::to_string(first_errors));
+    
+    // After reset() the same chunks are handed out again, with no new ones
+    // and still without overlaps
+    std::size_t chunks = pool.chunks_count();
+    pool.reset();
+    std::size_t second_errors = allocate_all();
+    UTIL_TEST_ASSERT(second_errors == 0 && pool.chunks_count() == chunks, "Arena reuse after reset", "0 overlaps", std::to_string(second_errors) + " overlaps, " + std::to_string(pool.chunks_count()) + " chunks");
+    
+    void* aligned = pool.allocate(24, 64);
+    UTIL_TEST_ASSERT(aligned && reinterpret_cast<std::uintptr_t>(aligned) % 64 == 0, "Arena alignment", "64-byte aligned", "unaligned");
+    
+    // One thread interleaving more pools than it caches cursors for must not
+    // take a chunk per allocation
+    std::vector<std::unique_ptr<MemoryPool>> pools;
+    for (int i = 0; i < 6; ++i) {
+        pools.push_back(std::make_unique<MemoryPool>(1024 * 1024));
+    }
+    std::size_t interleaved_overlaps = 0;
+    std::vector<std::vector<char*>> interleaved(pools.size());
+    for (int i = 0; i < 1000; ++i) {
+        for (std::size_t p = 0; p < pools.size(); ++p) {
+            interleaved[p].push_back(static_cast<char*>(pools[p]->allocate(32)));
+        }
+    }
+    std::size_t max_chunks = 0;
+    for (std::size_t p = 0; p < pools.size(); ++p) {
+        std::sort(interleaved[p].begin(), interleaved[p].end());
+        for (std::size_t i = 1; i < interleaved[p].size(); ++i) {
+            interleaved_overlaps += interleaved[p][i] < interleaved[p][i - 1] + 32;
+        }
+        max_chunks = std::max(max_chunks, pools[p]->chunks_count());
+    }
+    UTIL_TEST_ASSERT(max_chunks == 1 && interleaved_overlaps == 0, "Arena with more pools than cursors", "1 chunk", std::to_string(max_chunks) + " chunks");
+    
+    // A cursor evicted once cold hands the rest of its chunk back to its pool
+    for (int i = 0; i < 5000; ++i) {
+        pools[5]->allocate(32);
+    }
+    for (std::size_t p = 0; p < 5; ++p) {
+        pools[p]->allocate(32);
+    }
+    std::size_t total_chunks = 0;
+    for (std::size_t p = 0; p < 5; ++p) {
+        total_chunks += pools[p]->chunks_count();
+    }
+    UTIL_TEST_ASSERT(total_chunks == 5, "Evicted cursor tail reused", "5", std::to_string(total_chunks));
+}
+
+/**
+ * @brief Test arena-backed record storage
+ */
+void test_arena_storage() {
+    std::cout << "\n=== Arena Storage Tests ===" << std::endl;
+    
+    CoverageDatabase db(StorageMode::ARENA);
+    auto assert_cov = db.create_assert_coverage();
+    assert_cov->assert_name = db.make_string("chk_valid");
+    assert_cov->instance_path = db.make_string("tb.cpu.alu");
+    assert_cov->severity = db.make_string("FAIL");
+    AssertCoverage copy = *assert_cov;
+    db.add_assert_coverage(std::move(assert_cov));
+    
+    const AssertCoverage* found = db.find_assert_coverage("chk_valid");
+    UTIL_TEST_ASSERT(found && found->instance_path == "tb.cpu.alu", "Arena record lookup", "tb.cpu.alu", (found ? found->instance_path.str() : "null"));
+    UTIL_TEST_ASSERT(found && std::string(found->severity.c_str()) == "FAIL", "Arena string NUL-terminated", "FAIL", (found ? found->severity.c_str() : "null"));
+    UTIL_TEST_ASSERT(db.arena_bytes() > 0, "Arena holds records", "> 0", std::to_string(db.arena_bytes()));
+    
+    // Heap records are accepted alongside arena ones
+    auto heap_group = std::make_unique<CoverageGroup>("tb.cpu::cg");
+    db.add_coverage_group(std::move(heap_group));
+    UTIL_TEST_ASSERT(db.get_num_groups() == 1, "Heap record in arena database", "1", std::to_string(db.get_num_groups()));
+    
+    db.reset();
+    UTIL_TEST_ASSERT(db.get_num_asserts() == 0 && copy.instance_path == "tb.cpu.alu", "Copies outlive arena reset", "tb.cpu.alu", copy.instance_path.str());
+}
+
+/**
+ * @brief Test database-wide string interning
+ */
+void test_string_interning() {
+    std::cout << "\n=== String Interning Tests ===" << std::endl;
+    
+    StringInterner strings;
+    std::string_view first = strings.intern("tb.cpu.alu");
+    std::string_view second = strings.intern(std::string("tb.cpu.") + "alu");
+    UTIL_TEST_ASSERT(first.data() == second.data(), "Interned strings shared", "same pointer", "different pointers");
+    UTIL_TEST_ASSERT(strings.size() == 1 && first.data()[first.size()] == '\0', "Interned string stored once", "1", std::to_string(strings.size()));
+    UTIL_TEST_ASSERT(strings.find("tb.cpu").data() == nullptr, "Interner find absent", "nullptr", std::string(strings.find("tb.cpu")));
+    
+    // Records of one instance share its path, and table keys share record names
+    CoverageDatabase db;
+    for (const char* name : {"chk_a", "chk_b"}) {
+        auto assert_cov = db.create_assert_coverage();
+        assert_cov->assert_name = db.intern(name);
+        assert_cov->instance_path = db.intern("tb.cpu.alu");
+        db.add_assert_coverage(std::move(assert_cov));
+    }
+    const AssertCoverage* a = db.find_assert_coverage("chk_a");
+    const AssertCoverage* b = db.find_assert_coverage("chk_b");
+    UTIL_TEST_ASSERT(a && b && a->instance_path.data() == b->instance_path.data(), "Records share interned path", "same pointer", "different pointers");
+    UTIL_TEST_ASSERT(db.asserts_table.find("chk_a")->first.data() == a->assert_name.data(), "Table key shares record name", "same pointer", "different pointers");
+    UTIL_TEST_ASSERT(db.strings().size() == 3, "Database interned strings", "3", std::to_string(db.strings().size()));
+    
+    // Lookup by a view into a larger buffer, as when cross-referencing a mapped file
+    std::string_view line = "FAIL 0 chk_b tb.cpu.alu";
+    UTIL_TEST_ASSERT(db.find_assert_coverage(line.substr(7, 5)) == b, "Lookup by string_view", "chk_b", std::string(line.substr(7, 5)));
+}
+
+/**
+ * @brief Test the open-addressing flat hash map: growth, erase, reinsertion and iteration
+ */
+void test_flat_hash_map() {
+    std::cout << "\n=== Flat Hash Map Tests ===" << std::endl;
+    
+    // Enough keys to grow through several capacities, then erase every other one
+    FlatHashMap<int, int> table;
+    for (int i = 0; i < 1000; ++i) {
+        table[i] = i * 2;
+    }
+    for (int i = 0; i < 1000; i += 2) {
+        table.erase(i);
+    }
+    bool all_found = true;
+    for (int i = 0; i < 1000; ++i) {
+        auto it = table.find(i);
+        all_found &= (i % 2 == 0) ? it == table.end() : (it != table.end() && it->second == i * 2);
+    }
+    UTIL_TEST_ASSERT(table.size() == 500 && all_found, "Flat map find after erase", "500", std::to_string(table.size()));
+    
+    // Reinserting into freed slots must not duplicate keys
+    for (int i = 0; i < 1000; ++i) {
+        table.try_emplace(i, -1);
+    }
+    std::size_t visited = 0;
+    long long sum = 0;
+    for (const auto& [key, value] : table) {
+        ++visited;
+        sum += key;
+        (void)value;
+    }
+    UTIL_TEST_ASSERT(visited == 1000 && sum == 499500, "Flat map iteration", "1000", std::to_string(visited));
+    UTIL_TEST_ASSERT(table[0] == -1 && table[1] == 2, "Flat map try_emplace keeps existing", "-1 2", std::to_string(table[0]) + " " + std::to_string(table[1]));
+    
+    table.clear();
+    UTIL_TEST_ASSERT(table.empty() && table.begin() == table.end() && !table.contains(1), "Flat map clear", "empty", std::to_string(table.size()));
+}
+
+/**
+ * @brief Test the columnar group view and its refresh after writes
+ */
+void test_group_columns() {
+    std::cout << "\n=== Group Columns Tests ===" << std::endl;
+    
+    CoverageDatabase db;
+    db.reserve_coverage_groups(3);
+    const std::uint32_t metrics[][2] = {{0, 10}, {5, 10}, {20, 20}};
+    for (std::size_t i = 0; i < 3; ++i) {
+        auto group = db.create_coverage_group();
+        group->name = db.intern("cg_" + std::to_string(i));
+        group->coverage = CoverageMetrics(metrics[i][0], metrics[i][1]);
+        db.add_coverage_group(std::move(group));
+    }
+    
+    const GroupColumns& columns = db.group_columns();
+    UTIL_TEST_ASSERT(columns.size() == 3 && columns.expected.size() == 3 && columns.groups.size() == 3, "Group columns rows", "3", std::to_string(columns.size()));
+    UTIL_TEST_ASSERT(std::abs(db.calculate_overall_score() - 62.5) < 0.001, "Columnar overall score", "62.5", std::to_string(db.calculate_overall_score()));
+    auto stats = db.generate_statistics();
+    UTIL_TEST_ASSERT(stats->num_zero_coverage_groups == 1 && stats->num_full_coverage_groups == 1 && stats->covered_points == 25, "Columnar statistics", "1 1 25", std::to_string(stats->num_zero_coverage_groups) + " " + std::to_string(stats->num_full_coverage_groups) + " " + std::to_string(stats->covered_points));
+    
+    // Writing through a non-const lookup must not leave the columns stale
+    db.find_coverage_group("cg_0")->coverage = CoverageMetrics(10, 10);
+    UTIL_TEST_ASSERT(db.get_uncovered_groups().empty() && std::abs(db.calculate_overall_score() - 87.5) < 0.001, "Group columns refreshed", "87.5", std::to_string(db.calculate_overall_score()));
+    
+    // So must writing through the results of a non-const group query
+    for (std::size_t i = 3; i < 5; ++i) {
+        auto group = db.create_coverage_group();
+        group->name = db.intern("cg_" + std::to_string(i));
+        group->coverage = CoverageMetrics(0, 10);
+        db.add_coverage_group(std::move(group));
+    }
+    const CoverageDatabase& view = db;
+    UTIL_TEST_ASSERT(view.get_uncovered_groups().size() == 2 && std::abs(view.calculate_overall_score() - 35.0 * 100 / 60) < 0.001, "Uncovered groups added", "2", std::to_string(view.get_uncovered_groups().size()));
+    for (CoverageGroup* group : db.get_uncovered_groups()) {
+        group->coverage = CoverageMetrics(10, 10);
+    }
+    UTIL_TEST_ASSERT(view.get_uncovered_groups().empty() && std::abs(view.calculate_overall_score() - 55.0 * 100 / 60) < 0.001, "Group columns refreshed after query", "91.667", std::to_string(view.calculate_overall_score()));
+}
+
+/**
+ * @brief Test the hierarchy tree: implicit ancestors, links and subtree rollups
+ */
+void test_hierarchy_tree() {
+    std::cout << "\n=== Hierarchy Tree Tests ===" << std::endl;
+    
+    // tb.cpu has no record of its own: the tree creates it implicitly
+    CoverageDatabase db;
+    const char* paths[] = {"tb.cpu.alu", "tb.cpu.fpu", "tb.mem", "tb"};
+    const std::uint32_t metrics[][2] = {{1, 4}, {3, 4}, {0, 2}, {0, 0}};
+    for (std::size_t i = 0; i < 4; ++i) {
+        auto instance = db.create_hierarchy_instance();
+        instance->instance_path = db.intern(paths[i]);
+        instance->assert_coverage = CoverageMetrics(metrics[i][0], metrics[i][1]);
+        db.add_hierarchy_instance(std::move(instance));
+    }
+    
+    const HierarchyTree& tree = db.hierarchy_tree();
+    HierarchyTree::NodeId cpu = tree.find("tb.cpu");
+    UTIL_TEST_ASSERT(tree.size() == 5 && cpu != HierarchyTree::INVALID_NODE && tree.instance(cpu) == nullptr, "Tree implicit ancestor", "5", std::to_string(tree.size()));
+    UTIL_TEST_ASSERT(tree.parent(cpu) == tree.find("tb") && tree.depth(cpu) == 1 && tree.name(tree.first_child(cpu)) == "alu", "Tree parent/child links", "alu", std::string(tree.name(tree.first_child(cpu))));
+    
+    SubtreeCoverage cpu_totals = tree.subtree_coverage("tb.cpu");
+    SubtreeCoverage all_totals = tree.subtree_coverage("tb");
+    UTIL_TEST_ASSERT(cpu_totals.assert_covered == 4 && cpu_totals.assert_expected == 8 && cpu_totals.instances == 2, "Subtree rollup", "4/8", std::to_string(cpu_totals.assert_covered) + "/" + std::to_string(cpu_totals.assert_expected));
+    UTIL_TEST_ASSERT(all_totals.assert_expected == 10 && all_totals.instances == 4, "Root rollup", "10", std::to_string(all_totals.assert_expected));
+    
+    std::size_t visited = 0;
+    tree.for_each_in_subtree(cpu, [&](HierarchyTree::NodeId) { ++visited; });
+    UTIL_TEST_ASSERT(visited == 3, "Subtree walk", "3", std::to_string(visited));
+    
+    // Rollups follow writes made through a non-const lookup
+    db.find_hierarchy_instance("tb.mem")->assert_coverage = CoverageMetrics(2, 2);
+    UTIL_TEST_ASSERT(db.hierarchy_tree().subtree_coverage("tb").assert_covered == 6, "Rollup refreshed", "6", std::to_string(db.hierarchy_tree().subtree_coverage("tb").assert_covered));
+}
+
+/**
+ * @brief Test the sorted-name index: prefix, scope and exact lookups
+ */
+void test_name_index() {
+    std::cout << "\n=== Name Index Tests ===" << std::endl;
+    
+    CoverageDatabase db;
+    const char* names[] = {"tb.cpu2.cg", "tb.cpu.alu.cg", "tb.cpu::cg", "tb.cpu", "tb.mem.cg"};
+    for (const char* name : names) {
+        auto group = db.create_coverage_group();
+        group->name = db.intern(name);
+        db.add_coverage_group(std::move(group));
+    }
+    
+    const NameIndex<CoverageGroup>& index = db.group_index();
+    UTIL_TEST_ASSERT(index.size() == 5 && index.all().begin()->name == "tb.cpu", "Index sorted by name", "tb.cpu", std::string(index.all().begin()->name));
+    UTIL_TEST_ASSERT(index.find_prefix("tb.cpu").size() == 4 && index.find_prefix("tb.x").empty(), "Prefix query", "4", std::to_string(index.find_prefix("tb.cpu").size()));
+    
+    // The scope excludes tb.cpu2, which only shares a string prefix
+    std::vector<const CoverageGroup*> scope = std::as_const(db).get_groups_in_scope("tb.cpu");
+    UTIL_TEST_ASSERT(scope.size() == 3 && scope[0]->name == "tb.cpu", "Scope query", "3", std::to_string(scope.size()));
+    UTIL_TEST_ASSERT(index.find("tb.cpu::cg") != nullptr && index.find("tb.cp") == nullptr, "Exact lookup", "found", (index.find("tb.cpu::cg") ? "found" : "missing"));
+    
+    // Adding a record rebuilds the index on the next query
+    auto group = db.create_coverage_group();
+    group->name = db.intern("tb.cpu.fpu.cg");
+    db.add_coverage_group(std::move(group));
+    UTIL_TEST_ASSERT(db.get_groups_in_scope("tb.cpu").size() == 4, "Index refreshed", "4", std::to_string(db.get_groups_in_scope("tb.cpu").size()));
+}
+
+/**
+ * @brief Test trigram-indexed substring and glob name searches
+ */
+void test_trigram_index() {
+    std::cout << "\n=== Trigram Index Tests ===" << std::endl;
+    
+    CoverageDatabase db;
+    const char* names[] = {"tb.axi_wr.cg", "tb.axi_rd.cg", "tb.ahb.axi_wr_fifo", "tb.apb", "wr"};
+    for (const char* name : names) {
+        auto assert_cov = db.create_assert_coverage();
+        assert_cov->assert_name = db.intern(name);
+        db.add_assert_coverage(std::move(assert_cov));
+    }
+    
+    UTIL_TEST_ASSERT(db.get_asserts_by_pattern("axi_wr").size() == 2 && db.get_asserts_by_pattern("axi_wd").empty(), "Trigram substring query", "2", std::to_string(db.get_asserts_by_pattern("axi_wr").size()));
+    // Needles shorter than a trigram verify every name
+    UTIL_TEST_ASSERT(db.get_asserts_by_pattern("wr").size() == 3 && db.get_asserts_by_pattern("").size() == 5, "Short substring query", "3", std::to_string(db.get_asserts_by_pattern("wr").size()));
+    UTIL_TEST_ASSERT(db.get_asserts_by_glob("tb.axi_??.cg").size() == 2 && db.get_asserts_by_glob("*fifo").size() == 1 && db.get_asserts_by_glob("tb.a*").size() == 4, "Glob query", "2 1 4", std::to_string(db.get_asserts_by_glob("tb.axi_??.cg").size()) + " " + std::to_string(db.get_asserts_by_glob("*fifo").size()) + " " + std::to_string(db.get_asserts_by_glob("tb.a*").size()));
+    UTIL_TEST_ASSERT(TrigramIndex<AssertCoverage>::glob_match("a*b?c", "axxbyc") && !TrigramIndex<AssertCoverage>::glob_match("a*b?c", "axxbc"), "Glob matching", "true", "false");
+}
+
+/**
+ * @brief Test the sharded ingest: concurrent batches, batch precedence and file order
+ */
+void test_sharded_ingest() {
+    std::cout << "\n=== Sharded Ingest Tests ===" << std::endl;
+    
+    // Four workers stage overlapping batches at once: the highest batch must
+    // win every shared name, whichever thread finishes last
+    CoverageDatabase db;
+    db.begin_ingest(8);
+    std::vector<std::thread> workers;
+    for (std::uint32_t batch = 0; batch < 4; ++batch) {
+        workers.emplace_back([&db, batch]() {
+            std::vector<RecordPtr<CoverageGroup>> groups;
+            for (std::uint32_t i = 0; i < 1000; ++i) {
+                auto group = db.create_coverage_group();
+                group->name = db.intern("cg_" + std::to_string(i));
+                group->coverage = CoverageMetrics(batch, 4);
+                groups.push_back(std::move(group));
+            }
+            auto own = db.create_coverage_group();
+            own->name = db.intern("batch_" + std::to_string(batch));
+            groups.push_back(std::move(own));
+            db.ingest_coverage_groups(batch, groups.data(), groups.size());
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    UTIL_TEST_ASSERT(db.get_num_groups() == 0 && db.is_ingesting(), "Ingest staged until finished", "0", std::to_string(db.get_num_groups()));
+    db.finish_ingest();
+    
+    std::size_t latest = 0;
+    for (std::uint32_t i = 0; i < 1000; ++i) {
+        latest += db.find_coverage_group("cg_" + std::to_string(i))->coverage.covered == 3 ? 1 : 0;
+    }
+    UTIL_TEST_ASSERT(db.get_num_groups() == 1004 && latest == 1000, "Later batch wins", "1004 1000", std::to_string(db.get_num_groups()) + " " + std::to_string(latest));
+    
+    // Instances are filed in batch order, so tree children keep file order
+    db.begin_ingest();
+    const char* paths[] = {"tb.b", "tb.a"};
+    for (std::uint32_t batch = 2; batch-- > 0;) {
+        auto instance = db.create_hierarchy_instance();
+        instance->instance_path = db.intern(paths[1 - batch]);
+        db.ingest_hierarchy_instances(batch, &instance, 1);
+    }
+    db.finish_ingest();
+    const HierarchyTree& tree = db.hierarchy_tree();
+    UTIL_TEST_ASSERT(tree.name(tree.first_child(tree.find("tb"))) == "a", "Ingest keeps file order", "a", std::string(tree.name(tree.first_child(tree.find("tb")))));
+}
+
+/**
+ * @brief Test the binary snapshot: write, mapped lookups, load and corruption detection
+ */
+void test_snapshot() {
+    std::cout << "\n=== Snapshot Tests ===" << std::endl;
+    
+    CoverageDatabase db;
+    db.dashboard_data = std::make_unique<DashboardData>();
+    db.dashboard_data->user = "regress";
+    for (std::uint32_t i = 0; i < 100; ++i) {
+        auto group = db.create_coverage_group();
+        group->name = db.intern("tb.cg_" + std::to_string(i));
+        group->coverage = CoverageMetrics(i % 10, 10);
+        db.add_coverage_group(std::move(group));
+    }
+    auto assert_cov = db.create_assert_coverage();
+    assert_cov->assert_name = db.intern("chk_valid");
+    assert_cov->file_location = db.intern("alu.sv");
+    assert_cov->hit_count = 7;
+    db.add_assert_coverage(std::move(assert_cov));
+    for (std::uint32_t i = 0; i < 50; ++i) {
+        auto instance = db.create_hierarchy_instance();
+        instance->instance_path = db.intern("tb.u" + std::to_string((i * 37) % 50) + ".core");
+        db.add_hierarchy_instance(std::move(instance));
+    }
+    
+    ParserResult written = write_snapshot(db, "test_util_snapshot.fcsnap");
+    UTIL_TEST_ASSERT(written == ParserResult::SUCCESS, "Snapshot write", "SUCCESS", parser_result_to_string(written));
+    
+    // The reader answers from the mapping: records, strings and hash lookups
+    SnapshotReader reader;
+    ParserResult opened = reader.open("test_util_snapshot.fcsnap", true);
+    const snapshot::GroupRecord* group = reader.find_group("tb.cg_42");
+    const snapshot::AssertRecord* stored_assert = reader.find_assert("chk_valid");
+    UTIL_TEST_ASSERT(opened == ParserResult::SUCCESS && reader.groups().size() == 100 && group && group->coverage.covered == 2, "Snapshot group lookup", "2", (group ? std::to_string(group->coverage.covered) : "missing"));
+    UTIL_TEST_ASSERT(stored_assert && reader.text(stored_assert->file_location) == "alu.sv" && stored_assert->hit_count == 7, "Snapshot strings", "alu.sv", (stored_assert ? std::string(reader.text(stored_assert->file_location)) : "missing"));
+    UTIL_TEST_ASSERT(reader.find_group("tb.cg_100") == nullptr && reader.dashboard() && reader.text(reader.dashboard()->user) == "regress", "Snapshot miss and dashboard", "regress", (reader.dashboard() ? std::string(reader.text(reader.dashboard()->user)) : "missing"));
+    reader.close();
+    
+    CoverageDatabase loaded;
+    ParserResult load_result = load_snapshot("test_util_snapshot.fcsnap", loaded);
+    UTIL_TEST_ASSERT(load_result == ParserResult::SUCCESS && loaded.get_num_groups() == 100 && std::abs(loaded.calculate_overall_score() - db.calculate_overall_score()) < 1e-9, "Snapshot load", "100", std::to_string(loaded.get_num_groups()));
+    
+    // Instances are stored in tree order, so the reloaded tree keeps the
+    // report's child order rather than the hash table's
+    const HierarchyTree& original_tree = db.hierarchy_tree();
+    const HierarchyTree& loaded_tree = loaded.hierarchy_tree();
+    bool same_order = original_tree.size() == loaded_tree.size();
+    for (HierarchyTree::NodeId node = 0; same_order && node < original_tree.size(); ++node) {
+        same_order = original_tree.path(node) == loaded_tree.path(node);
+    }
+    const HierarchyTree::NodeId first_unit = loaded_tree.first_child(loaded_tree.find("tb"));
+    UTIL_TEST_ASSERT(same_order && loaded_tree.path(first_unit) == "tb.u0" && loaded_tree.path(loaded_tree.next_sibling(first_unit)) == "tb.u37", "Snapshot keeps tree order", "tb.u0 tb.u37", std::string(loaded_tree.path(first_unit)));
+    
+    // Merging into a populated database extends its tree with the new ancestors
+    CoverageDatabase populated;
+    auto extra = populated.create_hierarchy_instance();
+    extra->instance_path = populated.intern("tb.extra.core");
+    populated.add_hierarchy_instance(std::move(extra));
+    ParserResult merge_result = merge_snapshot("test_util_snapshot.fcsnap", populated);
+    UTIL_TEST_ASSERT(merge_result == ParserResult::SUCCESS && populated.get_num_hierarchy_instances() == 51 && populated.get_num_groups() == 100 && populated.hierarchy_tree().size() == original_tree.size() + 2 && populated.hierarchy_tree().subtree_coverage("tb").instances == 51, "Snapshot merge", "51", std::to_string(populated.get_num_hierarchy_instances()));
+    
+    // A flipped byte is caught by the checksums
+    {
+        std::fstream file("test_util_snapshot.fcsnap", std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(-2, std::ios::end);
+        file.put('#');
+    }
+    ParserResult corrupt = reader.open("test_util_snapshot.fcsnap", true);
+    UTIL_TEST_ASSERT(corrupt == ParserResult::ERROR_INVALID_FORMAT, "Snapshot corruption detected", "ERROR_INVALID_FORMAT", parser_result_to_string(corrupt));
+    
+    std::remove("test_util_snapshot.fcsnap");
+}
+
+/**
+ * @brief Test the parse cache: hits skip the parser and merge like a parse
+ */
+void test_parse_cache() {
+    std::cout << "\n=== Parse Cache Tests ===" << std::endl;
+    
+    const std::string directory = "test_util_parse_cache";
+    const std::string report = "test_util_cache_report.txt";
+    std::filesystem::remove_all(directory);
+    std::ofstream(report) << "group tb.cpu::cg_alu" << std::endl;
+    
+    // Stand-in parser: one group named after the report's contents
+    int parses = 0;
+    auto parse_file = [&parses](const std::string& filename, CoverageDatabase& db) {
+        ++parses;
+        std::ifstream file(filename);
+        std::string word, name;
+        file >> word >> name;
+        auto group = db.create_coverage_group();
+        group->name = db.intern(name);
+        group->coverage = CoverageMetrics(3, 4);
+        db.add_coverage_group(std::move(group));
+        db.is_valid = true;
+        return ParserResult::SUCCESS;
+    };
+    
+    ParseCache cache(directory);
+    CoverageDatabase first;
+    ParserResult miss = cache.parse(report, "groups", first, parse_file);
+    UTIL_TEST_ASSERT(miss == ParserResult::SUCCESS && parses == 1 && cache.misses() == 1 && first.get_num_groups() == 1, "Parse cache miss parses", "1", std::to_string(parses));
+    
+    CoverageDatabase second;
+    ParserResult hit = cache.parse(report, "groups", second, parse_file);
+    const CoverageGroup* cached = second.find_coverage_group("tb.cpu::cg_alu");
+    UTIL_TEST_ASSERT(hit == ParserResult::SUCCESS && parses == 1 && cache.hits() == 1 && cached && cached->coverage.covered == 3 && second.is_valid, "Parse cache hit skips parser", "1", std::to_string(parses));
+    
+    // A hit into a database that already holds records adds to it
+    CoverageDatabase merged(StorageMode::ARENA);
+    auto existing = merged.create_coverage_group();
+    existing->name = merged.intern("tb.mem::cg");
+    merged.add_coverage_group(std::move(existing));
+    cache.parse(report, "groups", merged, parse_file);
+    UTIL_TEST_ASSERT(parses == 1 && merged.get_num_groups() == 2 && merged.find_coverage_group("tb.mem::cg"), "Parse cache hit merges", "2", std::to_string(merged.get_num_groups()));
+    
+    // Another parser variant, or new contents of the same size, miss
+    CoverageDatabase other;
+    cache.parse(report, "assert", other, parse_file);
+    std::ofstream(report) << "group tb.cpu::cg_fpu" << std::endl;
+    CoverageDatabase rewritten;
+    cache.parse(report, "groups", rewritten, parse_file);
+    UTIL_TEST_ASSERT(parses == 3 && rewritten.find_coverage_group("tb.cpu::cg_fpu"), "Parse cache keys on variant and content", "3", std::to_string(parses));
+    
+    // open() maps the entry instead of rebuilding records, and stores one on a miss
+    SnapshotReader mapped;
+    ParserResult mapped_hit = cache.open(report, "groups", mapped, parse_file);
+    UTIL_TEST_ASSERT(mapped_hit == ParserResult::SUCCESS && parses == 3 && mapped.find_group("tb.cpu::cg_fpu"), "Parse cache mapped hit", "3", std::to_string(parses));
+    ParserResult mapped_miss = cache.open(report, "mapped", mapped, parse_file);
+    UTIL_TEST_ASSERT(mapped_miss == ParserResult::SUCCESS && parses == 4 && mapped.groups().size() == 1 && cache.open(report, "mapped", mapped, parse_file) == ParserResult::SUCCESS && parses == 4, "Parse cache mapped miss stores", "4", std::to_string(parses));
+    
+    std::filesystem::remove_all(directory);
+    std::remove(report.c_str());
+}
+
+/**
+ * @brief Test compressed report input: detection, streaming and whole-buffer decompression
+ */
+void test_compressed_input() {
+    std::cout << "\n=== Compressed Input Tests ===" << std::endl;
+    
+    // gzip of "tb.cpu::cg_alu 3 4\ntb.cpu::cg_fpu 1 4\n"
+    const unsigned char gzip_report[] = {
+        0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x2B, 0x49, 0xD2, 0x4B, 0x2E, 0x28,
+        0xB5, 0xB2, 0x4A, 0x4E, 0x8F, 0x4F, 0xCC, 0x29, 0x55, 0x30, 0x56, 0x30, 0xE1, 0x2A, 0x41, 0x08,
+        0xA5, 0x15, 0x94, 0x2A, 0x18, 0x02, 0x85, 0x00, 0x69, 0x44, 0xA8, 0x92, 0x26, 0x00, 0x00, 0x00};
+    const unsigned char zstd_magic[] = {0x28, 0xB5, 0x2F, 0xFD};
+    UTIL_TEST_ASSERT(detect_compression(gzip_report, sizeof(gzip_report)) == Compression::GZIP && detect_compression(zstd_magic, sizeof(zstd_magic)) == Compression::ZSTD && detect_compression("tb.cpu", 6) == Compression::NONE, "Compression detection", "GZIP/ZSTD/NONE", "mismatch");
+    
+    // Plain files read as through std::ifstream, including a rewind
+    std::ofstream("test_util_plain_report.txt") << "first" << std::endl << "second" << std::endl;
+    ReportStream plain("test_util_plain_report.txt");
+    std::string line;
+    std::getline(plain, line);
+    plain.clear();
+    plain.seekg(0, std::ios::beg);
+    std::string again;
+    std::getline(plain, again);
+    UTIL_TEST_ASSERT(plain.is_open() && plain.compression() == Compression::NONE && again == "first", "Report stream plain rewind", "first", again);
+    std::remove("test_util_plain_report.txt");
+    
+    if (!compression_supported(Compression::GZIP)) {
+        std::cout << "(gzip support not compiled in; skipping decompression tests)" << std::endl;
+        return;
+    }
+    
+    std::ofstream("test_util_report.txt.gz", std::ios::binary).write(reinterpret_cast<const char*>(gzip_report), sizeof(gzip_report));
+    ReportStream compressed("test_util_report.txt.gz");
+    std::vector<std::string> lines;
+    while (std::getline(compressed, line)) {
+        lines.push_back(line);
+    }
+    UTIL_TEST_ASSERT(compressed.compression() == Compression::GZIP && lines.size() == 2 && lines[1] == "tb.cpu::cg_fpu 1 4" && !compressed.bad(), "Report stream gzip", "tb.cpu::cg_fpu 1 4", (lines.size() == 2 ? lines[1] : std::to_string(lines.size())));
+    
+    std::unique_ptr<char[]> text;
+    std::size_t text_size = 0;
+    bool inflated = decompress_buffer(reinterpret_cast<const char*>(gzip_report), sizeof(gzip_report), Compression::GZIP, text, text_size);
+    UTIL_TEST_ASSERT(inflated && std::string(text.get(), text_size) == "tb.cpu::cg_alu 3 4\ntb.cpu::cg_fpu 1 4\n" && text[text_size] == '\0', "Decompress buffer gzip", "38 bytes", std::to_string(text_size));
+    
+    // A truncated member is an error, not a short report
+    std::ofstream("test_util_report.txt.gz", std::ios::binary).write(reinterpret_cast<const char*>(gzip_report), sizeof(gzip_report) - 6);
+    ReportStream truncated("test_util_report.txt.gz");
+    while (std::getline(truncated, line)) {
+    }
+    bool truncated_buffer = decompress_buffer(reinterpret_cast<const char*>(gzip_report), sizeof(gzip_report) - 6, Compression::GZIP, text, text_size);
+    UTIL_TEST_ASSERT(truncated.bad() && !truncated_buffer, "Truncated gzip detected", "bad", (truncated.bad() ? "bad" : "good"));
+    std::remove("test_util_report.txt.gz");
+}
+
+/**
+ * @brief Encode @p text as zstd frames of raw (stored) blocks
+ * 
+ * A valid stream for any zstd decoder, so the tests need no compressor.
+ * Each frame holds @p frame_bytes of text and records its content size.
+ */
+static std::string zstd_raw_frames(const std::string& text, std::size_t frame_bytes) {
+    constexpr std::size_t MAX_BLOCK = 128 * 1024;
+    std::string out;
+    for (std::size_t frame = 0; frame < text.size(); frame += frame_bytes) {
+        const std::size_t content = std::min(frame_bytes, text.size() - frame);
+        out.append("\x28\xB5\x2F\xFD\xE0", 5);  // Magic; single segment, 8-byte content size
+        for (int i = 0; i < 8; ++i) {
+            out.push_back(static_cast<char>((static_cast<std::uint64_t>(content) >> (8 * i)) & 0xFF));
+        }
+        for (std::size_t block = 0; block < content; block += MAX_BLOCK) {
+            const std::size_t size = std::min(MAX_BLOCK, content - block);
+            const std::uint32_t header = static_cast<std::uint32_t>(size << 3) | (block + size == content ? 1u : 0u);
+            out.push_back(static_cast<char>(header & 0xFF));
+            out.push_back(static_cast<char>((header >> 8) & 0xFF));
+            out.push_back(static_cast<char>((header >> 16) & 0xFF));
+            out.append(text, frame + block, size);
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief Encode @p text as one gzip member of stored deflate blocks
+ */
+static std::string gzip_stored(const std::string& text) {
+    std::uint32_t crc = 0xFFFFFFFFu;
+    for (unsigned char c : text) {
+        crc ^= c;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    crc = ~crc;
+    auto put32 = [](std::string& out, std::uint32_t value) {
+        for (int i = 0; i < 4; ++i) {
+            out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+        }
+    };
+    
+    std::string out("\x1F\x8B\x08\x00\x00\x00\x00\x00\x00\xFF", 10);
+    std::size_t offset = 0;
+    do {
+        const std::size_t size = std::min<std::size_t>(0xFFFF, text.size() - offset);
+        out.push_back(offset + size == text.size() ? 1 : 0);  // BFINAL, stored
+        out.push_back(static_cast<char>(size & 0xFF));
+        out.push_back(static_cast<char>(size >> 8));
+        out.push_back(static_cast<char>(~size & 0xFF));
+        out.push_back(static_cast<char>((~size >> 8) & 0xFF));
+        out.append(text, offset, size);
+        offset += size;
+    } while (offset < text.size());
+    put32(out, crc);
+    put32(out, static_cast<std::uint32_t>(text.size()));
+    return out;
+}
+
+/**
+ * @brief Test zstd input: single and multi-frame files, streamed and whole
+ */
+void test_zstd_input() {
+    std::cout << "\n=== Zstd Input Tests ===" << std::endl;
+    
+    if (!compression_supported(Compression::ZSTD)) {
+        std::cout << "(zstd support not compiled in; skipping zstd tests)" << std::endl;
+        return;
+    }
+    
+    // Over 1 MiB in six frames: decompress_buffer() takes the parallel path
+    std::string text;
+    for (std::uint32_t i = 0; text.size() < 1536 * 1024; ++i) {
+        text += "tb.u" + std::to_string(i) + "::cg " + std::to_string(i % 7) + " 8\n";
+    }
+    const std::string frames = zstd_raw_frames(text, 256 * 1024);
+    std::unique_ptr<char[]> output;
+    std::size_t output_size = 0;
+    bool decompressed = decompress_buffer(frames.data(), frames.size(), Compression::ZSTD, output, output_size);
+    UTIL_TEST_ASSERT(decompressed && output_size == text.size() && std::memcmp(output.get(), text.data(), text.size()) == 0 && output[output_size] == '\0', "Decompress buffer zstd frames", std::to_string(text.size()), std::to_string(output_size));
+    
+    const std::string single = zstd_raw_frames("tb.cpu::cg_alu 3 4\n", 1 << 20);
+    decompressed = decompress_buffer(single.data(), single.size(), Compression::ZSTD, output, output_size);
+    UTIL_TEST_ASSERT(decompressed && std::string(output.get(), output_size) == "tb.cpu::cg_alu 3 4\n", "Decompress buffer zstd single frame", "19 bytes", std::to_string(output_size));
+    
+    // The stream decoder crosses frame boundaries
+    std::ofstream("test_util_report.txt.zst", std::ios::binary) << frames;
+    ReportStream stream("test_util_report.txt.zst");
+    std::string line, last;
+    std::size_t lines = 0;
+    while (std::getline(stream, line)) {
+        ++lines;
+        last = line;
+    }
+    const std::size_t expected_lines = static_cast<std::size_t>(std::count(text.begin(), text.end(), '\n'));
+    UTIL_TEST_ASSERT(stream.compression() == Compression::ZSTD && !stream.bad() && lines == expected_lines && text.compare(text.size() - last.size() - 1, last.size(), last) == 0, "Report stream zstd frames", std::to_string(expected_lines), std::to_string(lines));
+    UTIL_TEST_ASSERT(report_content_size("test_util_report.txt.zst") == text.size(), "Zstd content size from frame headers", std::to_string(text.size()), std::to_string(report_content_size("test_util_report.txt.zst")));
+    
+    // A truncated frame is an error, not a short report
+    decompressed = decompress_buffer(frames.data(), frames.size() - 100, Compression::ZSTD, output, output_size);
+    UTIL_TEST_ASSERT(!decompressed, "Truncated zstd detected", "false", "true");
+    std::remove("test_util_report.txt.zst");
+}
+
+/**
+ * @brief Test that sequential mappings of compressed files hold the text
+ */
+void test_compressed_mapping() {
+    std::cout << "\n=== Compressed Mapping Tests ===" << std::endl;
+    
+    std::string text;
+    for (std::uint32_t i = 0; i < 20000; ++i) {
+        text += "tb.u" + std::to_string(i) + ".core\n";
+    }
+    const struct {
+        Compression compression;
+        const char* file;
+        std::string contents;
+    } inputs[] = {
+        {Compression::GZIP, "test_util_mapped.txt.gz", gzip_stored(text)},
+        {Compression::ZSTD, "test_util_mapped.txt.zst", zstd_raw_frames(text, 64 * 1024)},
+    };
+    for (const auto& input : inputs) {
+        const std::string name = input.compression == Compression::GZIP ? "gzip" : "zstd";
+        if (!compression_supported(input.compression)) {
+            std::cout << "(" << name << " support not compiled in; skipping)" << std::endl;
+            continue;
+        }
+        std::ofstream(input.file, std::ios::binary) << input.contents;
+        
+        // SEQUENTIAL (the parsers) replaces the mapping with the text; RANDOM keeps the file's bytes
+        {
+            MemoryMappedFile sequential(input.file, MemoryMappedFile::Access::SEQUENTIAL);
+            MemoryMappedFile random(input.file, MemoryMappedFile::Access::RANDOM);
+            UTIL_TEST_ASSERT(sequential.is_valid() && sequential.size() == text.size() && std::memcmp(sequential.data(), text.data(), text.size()) == 0 && sequential.data()[sequential.size()] == '\0', "Sequential mapping decompresses " + name, std::to_string(text.size()), std::to_string(sequential.size()));
+            UTIL_TEST_ASSERT(random.is_valid() && random.size() == input.contents.size() && detect_compression(random.data(), random.size()) == input.compression, "Random mapping keeps " + name + " bytes", std::to_string(input.contents.size()), std::to_string(random.size()));
+        }
+        std::remove(input.file);
+    }
+}
+
+/**
+ * @brief Test that both parser families parse compressed reports like plain ones
+ */
+void test_compressed_parse() {
+    std::cout << "\n=== Compressed Parse Tests ===" << std::endl;
+    
+    std::string text = "Assertion Coverage Report\nTotal Assertions: 3000\n"
+                       "STATUS  HITS  ASSERTION  INSTANCE  FILE:LINE\n";
+    for (std::uint32_t i = 0; i < 3000; ++i) {
+        text += std::string(i % 3 ? "PASS" : "FAIL") + "    " + std::to_string(i % 3 ? i : 0) + "    chk_" +
+                std::to_string(i) + "    tb.cpu" + std::to_string(i % 20) + "    cpu.sv:" + std::to_string(i + 1) + "\n";
+    }
+    std::ofstream("test_util_compressed_asserts.txt", std::ios::binary) << text;
+    CoverageDatabase plain;
+    ParserResult plain_result = AssertParser().parse("test_util_compressed_asserts.txt", plain);
+    
+    const struct {
+        Compression compression;
+        const char* file;
+        std::string contents;
+    } inputs[] = {
+        {Compression::GZIP, "test_util_compressed_asserts.txt.gz", gzip_stored(text)},
+        {Compression::ZSTD, "test_util_compressed_asserts.txt.zst", zstd_raw_frames(text, 32 * 1024)},
+    };
+    for (const auto& input : inputs) {
+        const std::string name = input.compression == Compression::GZIP ? "gzip" : "zstd";
+        if (!compression_supported(input.compression)) {
+            std::cout << "(" << name << " support not compiled in; skipping)" << std::endl;
+            continue;
+        }
+        std::ofstream(input.file, std::ios::binary) << input.contents;
+        
+        // Tables are sized from the decompressed text, not the file
+        UTIL_TEST_ASSERT(report_content_size(input.file) == text.size(), "Content size of " + name + " report", std::to_string(text.size()), std::to_string(report_content_size(input.file)));
+        
+        CoverageDatabase standard, fast;
+        ParserResult standard_result = AssertParser().parse(input.file, standard);
+        ParserResult fast_result = HighPerformanceAssertParser().parse(input.file, fast);
+        std::size_t mismatches = 0;
+        for (const auto& [assert_name, assert_cov] : plain.asserts_table) {
+            for (const CoverageDatabase* db : {&standard, &fast}) {
+                const AssertCoverage* parsed = db->find_assert_coverage(assert_name);
+                mismatches += !parsed || parsed->instance_path != assert_cov->instance_path ||
+                              parsed->is_covered != assert_cov->is_covered || parsed->hit_count != assert_cov->hit_count ||
+                              parsed->line_number != assert_cov->line_number;
+            }
+        }
+        UTIL_TEST_ASSERT(plain_result == ParserResult::SUCCESS && standard_result == ParserResult::SUCCESS && fast_result == ParserResult::SUCCESS && plain.get_num_asserts() == 3000 && standard.get_num_asserts() == 3000 && fast.get_num_asserts() == 3000 && mismatches == 0, "Parse " + name + " report", "0 mismatches", std::to_string(mismatches) + " mismatches, " + std::to_string(standard.get_num_asserts()) + "/" + std::to_string(fast.get_num_asserts()) + " asserts");
+        std::remove(input.file);
+    }
+    std::remove("test_util_compressed_asserts.txt");
+}
+
+/**
+ * @brief Test record streaming: pull reader, visitor early stop and parity with parse()
+ */
+void test_record_stream() {
+    std::cout << "\n=== Record Stream Tests ===" << std::endl;
+    
+    const std::string report = "test_util_stream_asserts.txt";
+    std::ofstream(report) << "Assertion Coverage Report" << std::endl
+                          << "Total Assertions: 3" << std::endl
+                          << "STATUS  HITS  ASSERTION  INSTANCE  FILE:LINE" << std::endl
+                          << "PASS    12    chk_req    tb.cpu    cpu.sv:45" << std::endl
+                          << "FAIL    0     chk_ack    tb.cpu    cpu.sv:51" << std::endl
+                          << "FAIL    0     chk_data   tb.mem    mem.sv:7" << std::endl;
+    
+    // Pull records; views point into the current line
+    RecordReader reader(report, ReportKind::ASSERTS);
+    std::vector<std::string> uncovered;
+    std::uint32_t records = 0;
+    while (reader.next()) {
+        const AssertRecord& record = reader.assert_record();
+        ++records;
+        if (!record.is_covered) {
+            uncovered.push_back(std::string(record.file_location) + ":" + std::to_string(record.line_number));
+        }
+    }
+    UTIL_TEST_ASSERT(reader.status() == ParserResult::SUCCESS && reader.declared_total() == 3 && records == 3 && uncovered.size() == 2 && uncovered[1] == "mem.sv:7", "Record reader pulls asserts", "mem.sv:7", (uncovered.size() == 2 ? uncovered[1] : std::to_string(uncovered.size())));
+    
+    // A visitor can stop the stream early without an error
+    struct FirstAssert : RecordVisitor {
+        std::string name;
+        std::uint32_t calls = 0;
+        bool on_assert(const AssertRecord& record) override {
+            name = std::string(record.assert_name);
+            ++calls;
+            return false;
+        }
+    } visitor;
+    AssertParser parser;
+    ParserResult result = parser.stream(report, visitor);
+    UTIL_TEST_ASSERT(result == ParserResult::SUCCESS && visitor.calls == 1 && visitor.name == "chk_req", "Parser streams to visitor", "chk_req", visitor.name);
+    
+    // Streaming and parsing read the same records
+    CoverageDatabase db;
+    parser.parse(report, db);
+    const AssertCoverage* parsed = db.find_assert_coverage("chk_req");
+    UTIL_TEST_ASSERT(db.get_num_asserts() == 3 && parsed && parsed->hit_count == 12 && parsed->severity == "PASS", "Parse matches stream", "3", std::to_string(db.get_num_asserts()));
+    
+    DashboardParser dashboard;
+    UTIL_TEST_ASSERT(dashboard.stream(report, visitor) == ParserResult::ERROR_INVALID_PARAMETER && RecordReader("test_util_missing.txt", ReportKind::GROUPS).status() == ParserResult::ERROR_FILE_NOT_FOUND, "Stream rejects dashboard and missing files", "errors", "success");
+    std::remove(report.c_str());
+}
+
 /**
  * @brief Main utility test runner
  */
@@ -245,6 +1465,29 @@ int main() {
         test_file_utilities();
         test_formatting_utilities();
         test_datetime_utilities();
+        test_fast_hierarchy_parser();
+        test_fast_assert_parser();
+        test_fast_module_list_parser();
+        test_line_classifiers();
+        test_line_tokenizer();
+        test_simd_kernels();
+        test_thread_pool();
+        test_memory_pool();
+        test_arena_storage();
+        test_string_interning();
+        test_flat_hash_map();
+        test_group_columns();
+        test_hierarchy_tree();
+        test_name_index();
+        test_trigram_index();
+        test_sharded_ingest();
+        test_snapshot();
+        test_parse_cache();
+        test_compressed_input();
+        test_zstd_input();
+        test_compressed_mapping();
+        test_compressed_parse();
+        test_record_stream();
     } catch (const std::exception& e) {
         std::cout << "Utility test suite failed with exception: " << e.what() << std::endl;
         return 1;